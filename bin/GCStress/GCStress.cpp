@@ -36,6 +36,9 @@ static const unsigned int initializeCount = 10000;
 static const unsigned int operationsPerHeapWalk = 100000;
 #endif
 
+// Number of heap operations between explicit partial collections in partial collect mode
+static const unsigned int operationsPerPartialCollect = 10000;
+
 // Some global variables
 
 // Recycler instance
@@ -68,6 +71,45 @@ WeightedTable<Operation> operationTable;
 // Not used currently, but keep for now
 bool verbose = false;
 
+// Interleave explicit partial collections with the heap operations, so that
+// partial collections run against heaps whose pages have been mutated since the last collection
+bool partialCollectMode = false;
+unsigned int partialCollectCount = 0;
+
+#if ENABLE_CONCURRENT_GC
+// Collect after each heap walk with four parallel threads, and check that the sweep was shared with them
+bool parallelSweepMode = false;
+#endif
+
+#if ENABLE_HUGE_PAGE_SEGMENTS
+// Back the recycler's page segments with transparent huge pages (-RecyclerHugePageSegments),
+// and report how much of the process is actually backed by them after each heap walk
+bool hugePageMode = false;
+
+// Sum of the AnonHugePages lines of /proc/self/smaps, in kB
+unsigned long GetAnonHugePagesKB()
+{
+    FILE * smaps = fopen("/proc/self/smaps", "r");
+    if (smaps == nullptr)
+    {
+        return 0;
+    }
+
+    static const char prefix[] = "AnonHugePages:";
+    unsigned long totalKB = 0;
+    char line[256];
+    while (fgets(line, sizeof(line), smaps) != nullptr)
+    {
+        if (strncmp(line, prefix, sizeof(prefix) - 1) == 0)
+        {
+            totalKB += atoi(line + sizeof(prefix) - 1);
+        }
+    }
+    fclose(smaps);
+    return totalKB;
+}
+#endif
+
 
 RecyclerTestObject * CreateNewObject()
 {
@@ -321,10 +363,50 @@ void SimpleRecyclerTest()
             for (unsigned int i = 0; i < operationsPerHeapWalk; i++)
             {
                 DoHeapOperation();
+
+#if ENABLE_PARTIAL_GC
+                if (partialCollectMode && i && (i % operationsPerPartialCollect) == 0)
+                {
+                    recyclerInstance->CollectNow<CollectNowConcurrentPartial>();
+                    partialCollectCount++;
+                }
+#endif
             }
             
             WalkHeap();
 
+#if ENABLE_HUGE_PAGE_SEGMENTS
+            if (hugePageMode)
+            {
+                wprintf(_u("AnonHugePages: %lu kB\n"), GetAnonHugePagesKB());
+            }
+#endif
+
+#if ENABLE_CONCURRENT_GC
+            if (parallelSweepMode)
+            {
+                RecyclerGCStats gcStats;
+                recyclerInstance->GetGCStats(&gcStats);
+                uint lastParallelSweepCount = gcStats.parallelSweepCount;
+
+                recyclerInstance->CollectNow<CollectNowForceInThread>();
+
+                recyclerInstance->GetGCStats(&gcStats);
+                VerifyCondition(gcStats.parallelSweepCount == lastParallelSweepCount + 1);
+                wprintf(_u("Parallel sweeps: %u\n"), gcStats.parallelSweepCount);
+            }
+#endif
+
+#if ENABLE_PARTIAL_GC
+            if (partialCollectMode)
+            {
+                RecyclerGCStats gcStats;
+                recyclerInstance->GetGCStats(&gcStats);
+                wprintf(_u("Partial collections: %u, rescanned bytes: %llu\n"),
+                    partialCollectCount, (unsigned long long)gcStats.rescannedBytes);
+            }
+#endif
+
             // Dispose now
             recyclerInstance->FinishDisposeObjectsNow<FinishDispose>();
         }
@@ -359,8 +441,11 @@ bool GetDeviceFamilyInfo(
 void usage(const WCHAR* self)
 {
     wprintf(
-        _u("usage: %s [-?|-v] [-js <jscript options from here on>]\n")
-        _u("  -v\n\tverbose logging\n"),
+        _u("usage: %s [-?|-v|-partial|-parallelsweep|-hugepages] [-js <jscript options from here on>]\n")
+        _u("  -v\n\tverbose logging\n")
+        _u("  -partial\n\tinterleave partial collections with heap operations\n")
+        _u("  -parallelsweep\n\tcollect with four parallel threads after each heap walk and check the sweep used them\n")
+        _u("  -hugepages\n\tback recycler page segments with huge pages and report AnonHugePages\n"),
         self);
 }
 
@@ -381,6 +466,22 @@ int __cdecl wmain(int argc, __in_ecount(argc) WCHAR* argv[])
             {
                 verbose = true;
             }
+            else if (wcscmp(argv[i], _u("-partial")) == 0)
+            {
+                partialCollectMode = true;
+            }
+#if ENABLE_CONCURRENT_GC
+            else if (wcscmp(argv[i], _u("-parallelsweep")) == 0)
+            {
+                parallelSweepMode = true;
+            }
+#endif
+#if ENABLE_HUGE_PAGE_SEGMENTS
+            else if (wcscmp(argv[i], _u("-hugepages")) == 0)
+            {
+                hugePageMode = true;
+            }
+#endif
             else if (wcscmp(argv[i], _u("-js")) == 0 || wcscmp(argv[i], _u("-JS")) == 0)
             {
                 jscriptOptions = i;
@@ -408,6 +509,24 @@ int __cdecl wmain(int argc, __in_ecount(argc) WCHAR* argv[])
         parser.Parse(argc - jscriptOptions, argv + jscriptOptions);
     }
 
+#if ENABLE_CONCURRENT_GC
+    if (parallelSweepMode)
+    {
+        Js::Configuration::Global.flags.RecyclerMaxParallelism = 4;
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+        // Use the four threads even with fewer processors
+        Js::Configuration::Global.flags.Force.Enable(Js::ParallelMarkPhase);
+#endif
+    }
+#endif
+
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    if (hugePageMode)
+    {
+        Js::Configuration::Global.flags.RecyclerHugePageSegments = true;
+    }
+#endif
+
     // Run the actual test
     SimpleRecyclerTest();
 
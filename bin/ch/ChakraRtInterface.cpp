@@ -111,6 +111,12 @@ HINSTANCE ChakraRTInterface::LoadChakraDll(ArgInfo* argInfo)
     m_jsApiHooks.pfJsrtRunSerializedScript = (JsAPIHooks::JsrtRunSerializedScriptPtr)GetChakraCoreSymbol(library, "JsRunSerializedScript");
     m_jsApiHooks.pfJsrtSetPromiseContinuationCallback = (JsAPIHooks::JsrtSetPromiseContinuationCallbackPtr)GetChakraCoreSymbol(library, "JsSetPromiseContinuationCallback");
     m_jsApiHooks.pfJsrtGetContextOfObject = (JsAPIHooks::JsrtGetContextOfObject)GetChakraCoreSymbol(library, "JsGetContextOfObject");
+    m_jsApiHooks.pfJsrtGetRuntimeGCStats = (JsAPIHooks::JsrtGetRuntimeGCStatsPtr)GetChakraCoreSymbol(library, "JsGetRuntimeGCStats");
+    m_jsApiHooks.pfJsrtSetRuntimeGCHeuristics = (JsAPIHooks::JsrtSetRuntimeGCHeuristicsPtr)GetChakraCoreSymbol(library, "JsSetRuntimeGCHeuristics");
+    m_jsApiHooks.pfJsrtCreateExternalObjectWithThreadAgnosticFinalizer = (JsAPIHooks::JsrtCreateExternalObjectWithThreadAgnosticFinalizerPtr)GetChakraCoreSymbol(library, "JsCreateExternalObjectWithThreadAgnosticFinalizer");
+    m_jsApiHooks.pfJsrtCreateExternalArrayBufferWithThreadAgnosticFinalizer = (JsAPIHooks::JsrtCreateExternalArrayBufferWithThreadAgnosticFinalizerPtr)GetChakraCoreSymbol(library, "JsCreateExternalArrayBufferWithThreadAgnosticFinalizer");
+    m_jsApiHooks.pfJsrtCreateExternalString = (JsAPIHooks::JsrtCreateExternalStringPtr)GetChakraCoreSymbol(library, "JsCreateExternalString");
+    m_jsApiHooks.pfJsrtCreateExternalStringUtf8 = (JsAPIHooks::JsrtCreateExternalStringUtf8Ptr)GetChakraCoreSymbol(library, "JsCreateExternalStringUtf8");
     m_jsApiHooks.pfJsrtParseScriptWithAttributes = (JsAPIHooks::JsrtParseScriptWithAttributes)GetChakraCoreSymbol(library, "JsParseScriptWithAttributes");
     m_jsApiHooks.pfJsrtDiagStartDebugging = (JsAPIHooks::JsrtDiagStartDebugging)GetChakraCoreSymbol(library, "JsDiagStartDebugging");
     m_jsApiHooks.pfJsrtDiagStopDebugging = (JsAPIHooks::JsrtDiagStopDebugging)GetChakraCoreSymbol(library, "JsDiagStopDebugging");
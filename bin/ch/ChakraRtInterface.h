@@ -48,6 +48,12 @@ struct JsAPIHooks
     typedef JsErrorCode (WINAPI *JsrtRunSerializedScriptPtr)(const char16 *script, BYTE *buffer, DWORD_PTR sourceContext, const char16 *sourceUrl, JsValueRef* result);
     typedef JsErrorCode (WINAPI *JsrtSetPromiseContinuationCallbackPtr)(JsPromiseContinuationCallback callback, void *callbackState);
     typedef JsErrorCode (WINAPI *JsrtGetContextOfObject)(JsValueRef object, JsContextRef *callbackState);
+    typedef JsErrorCode (WINAPI *JsrtGetRuntimeGCStatsPtr)(JsRuntimeHandle runtime, JsRuntimeGCStats *stats);
+    typedef JsErrorCode (WINAPI *JsrtSetRuntimeGCHeuristicsPtr)(JsRuntimeHandle runtime, const JsGCHeuristicSettings *settings);
+    typedef JsErrorCode (WINAPI *JsrtCreateExternalObjectWithThreadAgnosticFinalizerPtr)(void *data, JsFinalizeCallback finalizeCallback, JsValueRef *object);
+    typedef JsErrorCode (WINAPI *JsrtCreateExternalArrayBufferWithThreadAgnosticFinalizerPtr)(void *data, unsigned int byteLength, JsFinalizeCallback finalizeCallback, void *callbackState, JsValueRef *result);
+    typedef JsErrorCode (WINAPI *JsrtCreateExternalStringPtr)(const uint16_t *content, size_t stringLength, JsFinalizeCallback finalizeCallback, void *callbackState, JsValueRef *string);
+    typedef JsErrorCode (WINAPI *JsrtCreateExternalStringUtf8Ptr)(const char *content, size_t byteLength, JsFinalizeCallback finalizeCallback, void *callbackState, JsValueRef *string);
 
     typedef JsErrorCode(WINAPI *JsrtParseScriptWithAttributes)(const wchar_t *script, JsSourceContext sourceContext, const wchar_t *sourceUrl, JsParseScriptAttributes parseAttributes, JsValueRef *result);
     typedef JsErrorCode(WINAPI *JsrtDiagStartDebugging)(JsRuntimeHandle runtimeHandle, JsDiagDebugEventCallback debugEventCallback, void* callbackState);
@@ -111,6 +117,12 @@ struct JsAPIHooks
     JsrtRunSerializedScriptPtr pfJsrtRunSerializedScript;
     JsrtSetPromiseContinuationCallbackPtr pfJsrtSetPromiseContinuationCallback;
     JsrtGetContextOfObject pfJsrtGetContextOfObject;
+    JsrtGetRuntimeGCStatsPtr pfJsrtGetRuntimeGCStats;
+    JsrtSetRuntimeGCHeuristicsPtr pfJsrtSetRuntimeGCHeuristics;
+    JsrtCreateExternalObjectWithThreadAgnosticFinalizerPtr pfJsrtCreateExternalObjectWithThreadAgnosticFinalizer;
+    JsrtCreateExternalArrayBufferWithThreadAgnosticFinalizerPtr pfJsrtCreateExternalArrayBufferWithThreadAgnosticFinalizer;
+    JsrtCreateExternalStringPtr pfJsrtCreateExternalString;
+    JsrtCreateExternalStringUtf8Ptr pfJsrtCreateExternalStringUtf8;
     JsrtParseScriptWithAttributes pfJsrtParseScriptWithAttributes;
     JsrtDiagStartDebugging pfJsrtDiagStartDebugging;
     JsrtDiagStopDebugging pfJsrtDiagStopDebugging;
@@ -247,6 +259,12 @@ public:
     static JsErrorCode WINAPI JsRunSerializedScript(const char16 *script, BYTE *buffer, DWORD_PTR sourceContext, const char16 *sourceUrl, JsValueRef* result) { return m_jsApiHooks.pfJsrtRunSerializedScript(script, buffer, sourceContext, sourceUrl, result); }
     static JsErrorCode WINAPI JsSetPromiseContinuationCallback(JsPromiseContinuationCallback callback, void *callbackState) { return m_jsApiHooks.pfJsrtSetPromiseContinuationCallback(callback, callbackState); }
     static JsErrorCode WINAPI JsGetContextOfObject(JsValueRef object, JsContextRef* context) { return m_jsApiHooks.pfJsrtGetContextOfObject(object, context); }
+    static JsErrorCode WINAPI JsGetRuntimeGCStats(JsRuntimeHandle runtime, JsRuntimeGCStats *stats) { return m_jsApiHooks.pfJsrtGetRuntimeGCStats(runtime, stats); }
+    static JsErrorCode WINAPI JsSetRuntimeGCHeuristics(JsRuntimeHandle runtime, const JsGCHeuristicSettings *settings) { return m_jsApiHooks.pfJsrtSetRuntimeGCHeuristics(runtime, settings); }
+    static JsErrorCode WINAPI JsCreateExternalObjectWithThreadAgnosticFinalizer(void *data, JsFinalizeCallback finalizeCallback, JsValueRef *object) { return m_jsApiHooks.pfJsrtCreateExternalObjectWithThreadAgnosticFinalizer(data, finalizeCallback, object); }
+    static JsErrorCode WINAPI JsCreateExternalArrayBufferWithThreadAgnosticFinalizer(void *data, unsigned int byteLength, JsFinalizeCallback finalizeCallback, void *callbackState, JsValueRef *result) { return m_jsApiHooks.pfJsrtCreateExternalArrayBufferWithThreadAgnosticFinalizer(data, byteLength, finalizeCallback, callbackState, result); }
+    static JsErrorCode WINAPI JsCreateExternalString(const uint16_t *content, size_t stringLength, JsFinalizeCallback finalizeCallback, void *callbackState, JsValueRef *string) { return m_jsApiHooks.pfJsrtCreateExternalString(content, stringLength, finalizeCallback, callbackState, string); }
+    static JsErrorCode WINAPI JsCreateExternalStringUtf8(const char *content, size_t byteLength, JsFinalizeCallback finalizeCallback, void *callbackState, JsValueRef *string) { return m_jsApiHooks.pfJsrtCreateExternalStringUtf8(content, byteLength, finalizeCallback, callbackState, string); }
     static JsErrorCode WINAPI JsParseScriptWithAttributes(const wchar_t *script, JsSourceContext sourceContext, const wchar_t *sourceUrl, JsParseScriptAttributes parseAttributes, JsValueRef *result) { return m_jsApiHooks.pfJsrtParseScriptWithAttributes(script, sourceContext, sourceUrl, parseAttributes, result); }
     static JsErrorCode WINAPI JsDiagStartDebugging(JsRuntimeHandle runtimeHandle, JsDiagDebugEventCallback debugEventCallback, void* callbackState) { return m_jsApiHooks.pfJsrtDiagStartDebugging(runtimeHandle, debugEventCallback, callbackState); }
     static JsErrorCode WINAPI JsDiagStopDebugging(JsRuntimeHandle runtimeHandle, void** callbackState) { return m_jsApiHooks.pfJsrtDiagStopDebugging(runtimeHandle, callbackState); }
@@ -6,6 +6,8 @@
 #ifdef FLAG
 FLAG(BSTR, dbgbaseline,                     "Baseline file to compare debugger output", NULL)
 FLAG(bool, DebugLaunch,                     "Create the test debugger and execute test in the debug mode", false)
+FLAG(BSTR, GCHeuristic,                     "Collection policy to set with JsSetRuntimeGCHeuristics before running (default or adaptive)", NULL)
+FLAG(int,  GCHeapGrowthPercent,             "Heap growth percent to set with -GCHeuristic", 0)
 FLAG(BSTR, GenerateLibraryByteCodeHeader,   "Generate bytecode header file from library code", NULL)
 FLAG(int,  InspectMaxStringLength,          "Max string length to dump in locals inspection", 16)
 FLAG(BSTR, Serialized,                      "If source is UTF8, deserializes from bytecode file", NULL)
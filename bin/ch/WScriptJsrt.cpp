@@ -6,6 +6,12 @@
 
 MessageQueue* WScriptJsrt::messageQueue = nullptr;
 DWORD_PTR WScriptJsrt::sourceContext = 0;
+DWORD WScriptJsrt::scriptThreadId = 0;
+volatile LONG WScriptJsrt::threadAgnosticCreatedCount = 0;
+volatile LONG WScriptJsrt::threadAgnosticFinalizedCount = 0;
+volatile LONG WScriptJsrt::threadAgnosticFinalizedInThreadCount = 0;
+LONG WScriptJsrt::externalStringCreatedCount = 0;
+LONG WScriptJsrt::externalStringFinalizedCount = 0;
 
 DWORD_PTR WScriptJsrt::GetNextSourceContext()
 {
@@ -569,6 +575,83 @@ JsValueRef WScriptJsrt::RequestAsyncBreakCallback(JsValueRef callee, bool isCons
     return JS_INVALID_REFERENCE;
 }
 
+JsValueRef WScriptJsrt::GetGCStatsCallback(JsValueRef callee, bool isConstructCall, JsValueRef * arguments, unsigned short argumentCount, void * callbackState)
+{
+    JsContextRef currentContext = JS_INVALID_REFERENCE;
+    JsRuntimeHandle currentRuntime = JS_INVALID_RUNTIME_HANDLE;
+    JsRuntimeGCStats stats;
+    JsValueRef statsObject = JS_INVALID_REFERENCE;
+
+    IfJsErrorFailLogAndRet(ChakraRTInterface::JsGetCurrentContext(&currentContext));
+    IfJsErrorFailLogAndRet(ChakraRTInterface::JsGetRuntime(currentContext, &currentRuntime));
+    IfJsErrorFailLogAndRet(ChakraRTInterface::JsGetRuntimeGCStats(currentRuntime, &stats));
+    IfJsErrorFailLogAndRet(ChakraRTInterface::JsCreateObject(&statsObject));
+
+    if (!SetNumberProperty(statsObject, _u("collectionCount"), stats.collectionCount) ||
+        !SetNumberArrayProperty(statsObject, _u("collectionCountByTrigger"), stats.collectionCountByTrigger, _countof(stats.collectionCountByTrigger)) ||
+        !SetNumberProperty(statsObject, _u("lastTrigger"), stats.lastTrigger) ||
+        !SetNumberArrayProperty(statsObject, _u("lastPauseMicroseconds"), stats.lastPauseMicroseconds, _countof(stats.lastPauseMicroseconds)) ||
+        !SetNumberArrayProperty(statsObject, _u("totalPauseMicroseconds"), stats.totalPauseMicroseconds, _countof(stats.totalPauseMicroseconds)) ||
+        !SetNumberProperty(statsObject, _u("maxPauseMicroseconds"), (double)stats.maxPauseMicroseconds) ||
+        !SetNumberArrayProperty(statsObject, _u("liveBytes"), stats.liveBytes, _countof(stats.liveBytes)) ||
+        !SetNumberProperty(statsObject, _u("sweptBytes"), (double)stats.sweptBytes) ||
+        !SetNumberProperty(statsObject, _u("discardedBytes"), (double)stats.discardedBytes) ||
+        !SetNumberProperty(statsObject, _u("nextCollectionBytes"), (double)stats.nextCollectionBytes) ||
+        !SetNumberProperty(statsObject, _u("parallelSweepCount"), stats.parallelSweepCount) ||
+        !SetNumberProperty(statsObject, _u("parallelWeakReferenceSweepCount"), stats.parallelWeakReferenceSweepCount) ||
+        !SetNumberProperty(statsObject, _u("preciseStackFrameCount"), (double)stats.preciseStackFrameCount) ||
+        !SetNumberProperty(statsObject, _u("preciseStackFrameBytes"), (double)stats.preciseStackFrameBytes) ||
+        !SetNumberProperty(statsObject, _u("preciseStackSkippedBytes"), (double)stats.preciseStackSkippedBytes))
+    {
+        return JS_INVALID_REFERENCE;
+    }
+
+    return statsObject;
+}
+
+JsValueRef WScriptJsrt::SetGCHeuristicsCallback(JsValueRef callee, bool isConstructCall, JsValueRef * arguments, unsigned short argumentCount, void * callbackState)
+{
+    // WScript.SetGCHeuristics(mode, heapGrowthPercent, pauseTimePercent, minTriggerBytes, maxTriggerBytes), with mode
+    // "default" or "adaptive". Goes straight to JsSetRuntimeGCHeuristics on the running runtime, for testing its checks.
+    JsGCHeuristicSettings settings = {};
+    JsContextRef currentContext = JS_INVALID_REFERENCE;
+    JsRuntimeHandle currentRuntime = JS_INVALID_RUNTIME_HANDLE;
+    JsErrorCode errorCode = JsNoError;
+
+    if (argumentCount < 2)
+    {
+        SetExceptionFromErrorCode(JsErrorInvalidArgument);
+        return JS_INVALID_REFERENCE;
+    }
+
+    const wchar_t *mode;
+    size_t modeLength;
+    IfJsErrorFailLogAndRet(ChakraRTInterface::JsValueToWchar(arguments[1], &mode, &modeLength));
+    settings.mode = wcscmp(mode, _u("adaptive")) == 0 ? JsGCHeuristicModeAdaptive :
+        wcscmp(mode, _u("default")) == 0 ? JsGCHeuristicModeDefault : (JsGCHeuristicMode)-1;
+
+    double values[4] = {};
+    for (unsigned int i = 0; i < _countof(values) && i + 2u < argumentCount; i++)
+    {
+        JsValueRef numberValue;
+        IfJsErrorFailLogAndRet(ChakraRTInterface::JsConvertValueToNumber(arguments[i + 2], &numberValue));
+        IfJsErrorFailLogAndRet(ChakraRTInterface::JsNumberToDouble(numberValue, &values[i]));
+    }
+    settings.heapGrowthPercent = (unsigned int)values[0];
+    settings.pauseTimePercent = (unsigned int)values[1];
+    settings.minTriggerBytes = (size_t)values[2];
+    settings.maxTriggerBytes = (size_t)values[3];
+
+    IfJsErrorFailLogAndRet(ChakraRTInterface::JsGetCurrentContext(&currentContext));
+    IfJsErrorFailLogAndRet(ChakraRTInterface::JsGetRuntime(currentContext, &currentRuntime));
+    errorCode = ChakraRTInterface::JsSetRuntimeGCHeuristics(currentRuntime, &settings);
+    if (errorCode != JsNoError)
+    {
+        SetExceptionFromErrorCode(errorCode);
+    }
+    return JS_INVALID_REFERENCE;
+}
+
 JsValueRef WScriptJsrt::EmptyCallback(JsValueRef callee, bool isConstructCall, JsValueRef * arguments, unsigned short argumentCount, void * callbackState)
 {
     return JS_INVALID_REFERENCE;
@@ -582,6 +665,223 @@ bool WScriptJsrt::CreateNamedFunction(const char16* nameString, JsNativeFunction
     return true;
 }
 
+void CALLBACK WScriptJsrt::ThreadAgnosticFinalizeCallback(void * data)
+{
+    // May run on any thread: no JSRT calls here
+    free(data);
+    if (GetCurrentThreadId() == scriptThreadId)
+    {
+        InterlockedIncrement(&threadAgnosticFinalizedInThreadCount);
+    }
+    InterlockedIncrement(&threadAgnosticFinalizedCount);
+}
+
+JsValueRef WScriptJsrt::CreateThreadAgnosticObjectCallback(JsValueRef callee, bool isConstructCall, JsValueRef * arguments, unsigned short argumentCount, void * callbackState)
+{
+    // WScript.CreateThreadAgnosticObject() returns an external object whose finalizer may run off the script thread
+    JsValueRef object = JS_INVALID_REFERENCE;
+    IfJsErrorFailLogAndRet(ChakraRTInterface::JsCreateExternalObjectWithThreadAgnosticFinalizer(nullptr, ThreadAgnosticFinalizeCallback, &object));
+    InterlockedIncrement(&threadAgnosticCreatedCount);
+    return object;
+}
+
+JsValueRef WScriptJsrt::CreateThreadAgnosticArrayBufferCallback(JsValueRef callee, bool isConstructCall, JsValueRef * arguments, unsigned short argumentCount, void * callbackState)
+{
+    // WScript.CreateThreadAgnosticArrayBuffer(byteLength) returns an ArrayBuffer over malloc'd memory that its
+    // finalizer frees, possibly off the script thread
+    double byteLength = 0;
+    if (argumentCount > 1)
+    {
+        JsValueRef numberValue;
+        IfJsErrorFailLogAndRet(ChakraRTInterface::JsConvertValueToNumber(arguments[1], &numberValue));
+        IfJsErrorFailLogAndRet(ChakraRTInterface::JsNumberToDouble(numberValue, &byteLength));
+    }
+    if (!(byteLength >= 1 && byteLength <= 0x10000))
+    {
+        SetExceptionFromErrorCode(JsErrorInvalidArgument);
+        return JS_INVALID_REFERENCE;
+    }
+
+    void *data = calloc((size_t)byteLength, 1);
+    if (data == nullptr)
+    {
+        SetExceptionFromErrorCode(JsErrorOutOfMemory);
+        return JS_INVALID_REFERENCE;
+    }
+
+    JsValueRef arrayBuffer = JS_INVALID_REFERENCE;
+    JsErrorCode errorCode = ChakraRTInterface::JsCreateExternalArrayBufferWithThreadAgnosticFinalizer(data, (unsigned int)byteLength, ThreadAgnosticFinalizeCallback, data, &arrayBuffer);
+    if (errorCode != JsNoError)
+    {
+        free(data);
+        SetExceptionFromErrorCode(errorCode);
+        return JS_INVALID_REFERENCE;
+    }
+    InterlockedIncrement(&threadAgnosticCreatedCount);
+    return arrayBuffer;
+}
+
+JsValueRef WScriptJsrt::GetThreadAgnosticFinalizeStatsCallback(JsValueRef callee, bool isConstructCall, JsValueRef * arguments, unsigned short argumentCount, void * callbackState)
+{
+    JsValueRef statsObject = JS_INVALID_REFERENCE;
+    IfJsErrorFailLogAndRet(ChakraRTInterface::JsCreateObject(&statsObject));
+
+    if (!SetNumberProperty(statsObject, _u("createdCount"), threadAgnosticCreatedCount) ||
+        !SetNumberProperty(statsObject, _u("finalizedCount"), threadAgnosticFinalizedCount) ||
+        !SetNumberProperty(statsObject, _u("finalizedInThreadCount"), threadAgnosticFinalizedInThreadCount))
+    {
+        return JS_INVALID_REFERENCE;
+    }
+
+    return statsObject;
+}
+
+void CALLBACK WScriptJsrt::ExternalStringFinalizeCallback(void * data)
+{
+    free(data);
+    externalStringFinalizedCount++;
+}
+
+JsValueRef WScriptJsrt::CreateExternalStringCallback(JsValueRef callee, bool isConstructCall, JsValueRef * arguments, unsigned short argumentCount, void * callbackState)
+{
+    // WScript.CreateExternalString(string) returns a string over a copy of the argument's UTF-16 code units.
+    // The copy isn't null terminated: a non-null character follows it, so anything reading past the end shows.
+    JsValueRef stringValue;
+    const char16 *content;
+    size_t length;
+    if (argumentCount < 2)
+    {
+        SetExceptionFromErrorCode(JsErrorInvalidArgument);
+        return JS_INVALID_REFERENCE;
+    }
+    IfJsErrorFailLogAndRet(ChakraRTInterface::JsConvertValueToString(arguments[1], &stringValue));
+    IfJsErrorFailLogAndRet(ChakraRTInterface::JsStringToPointer(stringValue, &content, &length));
+
+    uint16_t *buffer = (uint16_t *)malloc((length + 1) * sizeof(uint16_t));
+    if (buffer == nullptr)
+    {
+        SetExceptionFromErrorCode(JsErrorOutOfMemory);
+        return JS_INVALID_REFERENCE;
+    }
+    memcpy(buffer, content, length * sizeof(uint16_t));
+    buffer[length] = _u('#');
+
+    JsValueRef externalString = JS_INVALID_REFERENCE;
+    JsErrorCode errorCode = ChakraRTInterface::JsCreateExternalString(buffer, length, ExternalStringFinalizeCallback, buffer, &externalString);
+    if (errorCode != JsNoError)
+    {
+        free(buffer);
+        SetExceptionFromErrorCode(errorCode);
+        return JS_INVALID_REFERENCE;
+    }
+    externalStringCreatedCount++;
+    return externalString;
+}
+
+JsValueRef WScriptJsrt::CreateExternalStringUtf8Callback(JsValueRef callee, bool isConstructCall, JsValueRef * arguments, unsigned short argumentCount, void * callbackState)
+{
+    // WScript.CreateExternalStringUtf8(string) returns a string over the argument encoded as UTF-8, again not
+    // null terminated
+    JsValueRef stringValue;
+    const char16 *content;
+    size_t length;
+    if (argumentCount < 2)
+    {
+        SetExceptionFromErrorCode(JsErrorInvalidArgument);
+        return JS_INVALID_REFERENCE;
+    }
+    IfJsErrorFailLogAndRet(ChakraRTInterface::JsConvertValueToString(arguments[1], &stringValue));
+    IfJsErrorFailLogAndRet(ChakraRTInterface::JsStringToPointer(stringValue, &content, &length));
+
+    char *utf8Content = nullptr;
+    if (FAILED(Helpers::WideStringToNarrowDynamic(content, &utf8Content)))
+    {
+        SetExceptionFromErrorCode(JsErrorOutOfMemory);
+        return JS_INVALID_REFERENCE;
+    }
+    size_t byteLength = strlen(utf8Content);
+    utf8Content[byteLength] = '#';
+
+    JsValueRef externalString = JS_INVALID_REFERENCE;
+    JsErrorCode errorCode = ChakraRTInterface::JsCreateExternalStringUtf8(utf8Content, byteLength, ExternalStringFinalizeCallback, utf8Content, &externalString);
+    if (errorCode != JsNoError)
+    {
+        free(utf8Content);
+        SetExceptionFromErrorCode(errorCode);
+        return JS_INVALID_REFERENCE;
+    }
+    externalStringCreatedCount++;
+    return externalString;
+}
+
+JsValueRef WScriptJsrt::GetExternalStringStatsCallback(JsValueRef callee, bool isConstructCall, JsValueRef * arguments, unsigned short argumentCount, void * callbackState)
+{
+    JsValueRef statsObject = JS_INVALID_REFERENCE;
+    IfJsErrorFailLogAndRet(ChakraRTInterface::JsCreateObject(&statsObject));
+
+    if (!SetNumberProperty(statsObject, _u("createdCount"), externalStringCreatedCount) ||
+        !SetNumberProperty(statsObject, _u("finalizedCount"), externalStringFinalizedCount))
+    {
+        return JS_INVALID_REFERENCE;
+    }
+
+    return statsObject;
+}
+
+void WScriptJsrt::ReportFinalizers()
+{
+    if (threadAgnosticCreatedCount != 0)
+    {
+        wprintf(_u("thread agnostic finalizers run by shutdown: %d of %d\n"), (int)threadAgnosticFinalizedCount, (int)threadAgnosticCreatedCount);
+    }
+    if (externalStringCreatedCount != 0)
+    {
+        wprintf(_u("external string finalizers run by shutdown: %d of %d\n"), (int)externalStringFinalizedCount, (int)externalStringCreatedCount);
+    }
+}
+
+bool WScriptJsrt::SetNumberProperty(JsValueRef object, const char16* name, double value)
+{
+    JsPropertyIdRef propertyId;
+    JsValueRef numberValue;
+    IfJsrtErrorFail(ChakraRTInterface::JsGetPropertyIdFromName(name, &propertyId), false);
+    IfJsrtErrorFail(ChakraRTInterface::JsDoubleToNumber(value, &numberValue), false);
+    IfJsrtErrorFail(ChakraRTInterface::JsSetProperty(object, propertyId, numberValue, true), false);
+    return true;
+}
+
+template <typename T>
+bool WScriptJsrt::SetNumberArrayProperty(JsValueRef object, const char16* name, const T* values, unsigned int count)
+{
+    JsPropertyIdRef propertyId;
+    JsValueRef arrayValue;
+    IfJsrtErrorFail(ChakraRTInterface::JsGetPropertyIdFromName(name, &propertyId), false);
+    IfJsrtErrorFail(ChakraRTInterface::JsCreateArray(count, &arrayValue), false);
+    for (unsigned int i = 0; i < count; i++)
+    {
+        JsValueRef index;
+        JsValueRef numberValue;
+        IfJsrtErrorFail(ChakraRTInterface::JsDoubleToNumber(i, &index), false);
+        IfJsrtErrorFail(ChakraRTInterface::JsDoubleToNumber((double)values[i], &numberValue), false);
+        IfJsrtErrorFail(ChakraRTInterface::JsSetIndexedProperty(arrayValue, index, numberValue), false);
+    }
+    IfJsrtErrorFail(ChakraRTInterface::JsSetProperty(object, propertyId, arrayValue, true), false);
+    return true;
+}
+
+void WScriptJsrt::SetExceptionFromErrorCode(JsErrorCode errorCode)
+{
+    // The message is the error code's name, e.g. "JsErrorRuntimeInUse"
+    LPCWSTR errorMessage = Helpers::JsErrorCodeToString(errorCode);
+    JsValueRef errorMessageString;
+    JsValueRef errorObject;
+    if (ChakraRTInterface::JsPointerToString(errorMessage, wcslen(errorMessage), &errorMessageString) == JsNoError &&
+        ChakraRTInterface::JsCreateError(errorMessageString, &errorObject) == JsNoError)
+    {
+        ChakraRTInterface::JsSetException(errorObject);
+    }
+}
+
 bool WScriptJsrt::InstallObjectsOnObject(JsValueRef object, const char16* name, JsNativeFunction nativeFunction)
 {
     JsValueRef propertyValueRef;
@@ -598,6 +898,9 @@ bool WScriptJsrt::Initialize()
     JsValueRef wscript;
     IfJsrtErrorFail(ChakraRTInterface::JsCreateObject(&wscript), false);
 
+    // Lets the thread agnostic finalizers tell whether they ran on the script thread
+    scriptThreadId = GetCurrentThreadId();
+
     IfFalseGo(WScriptJsrt::InstallObjectsOnObject(wscript, _u("Echo"), EchoCallback));
     IfFalseGo(WScriptJsrt::InstallObjectsOnObject(wscript, _u("Quit"), QuitCallback));
     IfFalseGo(WScriptJsrt::InstallObjectsOnObject(wscript, _u("LoadScriptFile"), LoadScriptFileCallback));
@@ -610,6 +913,14 @@ bool WScriptJsrt::Initialize()
     IfFalseGo(WScriptJsrt::InstallObjectsOnObject(wscript, _u("Detach"), DetachCallback));
     IfFalseGo(WScriptJsrt::InstallObjectsOnObject(wscript, _u("DumpFunctionPosition"), DumpFunctionPositionCallback));
     IfFalseGo(WScriptJsrt::InstallObjectsOnObject(wscript, _u("RequestAsyncBreak"), RequestAsyncBreakCallback));
+    IfFalseGo(WScriptJsrt::InstallObjectsOnObject(wscript, _u("GetGCStats"), GetGCStatsCallback));
+    IfFalseGo(WScriptJsrt::InstallObjectsOnObject(wscript, _u("SetGCHeuristics"), SetGCHeuristicsCallback));
+    IfFalseGo(WScriptJsrt::InstallObjectsOnObject(wscript, _u("CreateThreadAgnosticObject"), CreateThreadAgnosticObjectCallback));
+    IfFalseGo(WScriptJsrt::InstallObjectsOnObject(wscript, _u("CreateThreadAgnosticArrayBuffer"), CreateThreadAgnosticArrayBufferCallback));
+    IfFalseGo(WScriptJsrt::InstallObjectsOnObject(wscript, _u("GetThreadAgnosticFinalizeStats"), GetThreadAgnosticFinalizeStatsCallback));
+    IfFalseGo(WScriptJsrt::InstallObjectsOnObject(wscript, _u("CreateExternalString"), CreateExternalStringCallback));
+    IfFalseGo(WScriptJsrt::InstallObjectsOnObject(wscript, _u("CreateExternalStringUtf8"), CreateExternalStringUtf8Callback));
+    IfFalseGo(WScriptJsrt::InstallObjectsOnObject(wscript, _u("GetExternalStringStats"), GetExternalStringStatsCallback));
 
     // ToDo Remove
     IfFalseGo(WScriptJsrt::InstallObjectsOnObject(wscript, _u("Edit"), EmptyCallback));
@@ -8,6 +8,9 @@ class WScriptJsrt
 {
 public:
     static bool Initialize();
+    // Prints how many thread agnostic and external string finalizers have run, for those the script
+    // created any of. Call after JsDisposeRuntime.
+    static void ReportFinalizers();
 
     class CallbackMessage : public MessageBase
     {
@@ -66,6 +69,10 @@ public:
 private:
     static bool CreateArgumentsObject(JsValueRef *argsObject);
     static bool CreateNamedFunction(const char16*, JsNativeFunction callback, JsValueRef* functionVar);
+    static bool SetNumberProperty(JsValueRef object, const char16* name, double value);
+    template <typename T>
+    static bool SetNumberArrayProperty(JsValueRef object, const char16* name, const T* values, unsigned int count);
+    static void SetExceptionFromErrorCode(JsErrorCode errorCode);
     static JsValueRef __stdcall EchoCallback(JsValueRef callee, bool isConstructCall, JsValueRef *arguments, unsigned short argumentCount, void *callbackState);
     static JsValueRef __stdcall QuitCallback(JsValueRef callee, bool isConstructCall, JsValueRef *arguments, unsigned short argumentCount, void *callbackState);
     static JsValueRef __stdcall LoadModuleFileCallback(JsValueRef callee, bool isConstructCall, JsValueRef *arguments, unsigned short argumentCount, void *callbackState);
@@ -78,9 +85,29 @@ private:
     static JsValueRef __stdcall DetachCallback(JsValueRef callee, bool isConstructCall, JsValueRef *arguments, unsigned short argumentCount, void *callbackState);
     static JsValueRef __stdcall DumpFunctionPositionCallback(JsValueRef callee, bool isConstructCall, JsValueRef *arguments, unsigned short argumentCount, void *callbackState);
     static JsValueRef __stdcall RequestAsyncBreakCallback(JsValueRef callee, bool isConstructCall, JsValueRef *arguments, unsigned short argumentCount, void *callbackState);
+    static JsValueRef __stdcall GetGCStatsCallback(JsValueRef callee, bool isConstructCall, JsValueRef *arguments, unsigned short argumentCount, void *callbackState);
+    static JsValueRef __stdcall SetGCHeuristicsCallback(JsValueRef callee, bool isConstructCall, JsValueRef *arguments, unsigned short argumentCount, void *callbackState);
+    static JsValueRef __stdcall CreateThreadAgnosticObjectCallback(JsValueRef callee, bool isConstructCall, JsValueRef *arguments, unsigned short argumentCount, void *callbackState);
+    static JsValueRef __stdcall CreateThreadAgnosticArrayBufferCallback(JsValueRef callee, bool isConstructCall, JsValueRef *arguments, unsigned short argumentCount, void *callbackState);
+    static JsValueRef __stdcall GetThreadAgnosticFinalizeStatsCallback(JsValueRef callee, bool isConstructCall, JsValueRef *arguments, unsigned short argumentCount, void *callbackState);
+    static void CALLBACK ThreadAgnosticFinalizeCallback(void *data);
+    static JsValueRef __stdcall CreateExternalStringCallback(JsValueRef callee, bool isConstructCall, JsValueRef *arguments, unsigned short argumentCount, void *callbackState);
+    static JsValueRef __stdcall CreateExternalStringUtf8Callback(JsValueRef callee, bool isConstructCall, JsValueRef *arguments, unsigned short argumentCount, void *callbackState);
+    static JsValueRef __stdcall GetExternalStringStatsCallback(JsValueRef callee, bool isConstructCall, JsValueRef *arguments, unsigned short argumentCount, void *callbackState);
+    static void CALLBACK ExternalStringFinalizeCallback(void *data);
 
     static JsValueRef __stdcall EmptyCallback(JsValueRef callee, bool isConstructCall, JsValueRef *arguments, unsigned short argumentCount, void *callbackState);
 
     static MessageQueue *messageQueue;
     static DWORD_PTR sourceContext;
+
+    // Thread agnostic finalizers run on the recycler's finalizer thread, so these are updated interlocked
+    static DWORD scriptThreadId;
+    static volatile LONG threadAgnosticCreatedCount;
+    static volatile LONG threadAgnosticFinalizedCount;
+    static volatile LONG threadAgnosticFinalizedInThreadCount;
+
+    // External strings are finalized in thread
+    static LONG externalStringCreatedCount;
+    static LONG externalStringFinalizedCount;
 };
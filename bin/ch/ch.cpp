@@ -313,6 +313,15 @@ HRESULT ExecuteTest(const char* fileName)
     }
     IfJsErrorFailLog(ChakraRTInterface::JsCreateRuntime(jsrtAttributes, nullptr, &runtime));
 
+    if (HostConfigFlags::flags.GCHeuristicIsEnabled)
+    {
+        // The runtime must not be active yet
+        JsGCHeuristicSettings gcHeuristicSettings = {};
+        gcHeuristicSettings.mode = wcscmp(HostConfigFlags::flags.GCHeuristic, _u("adaptive")) == 0 ? JsGCHeuristicModeAdaptive : JsGCHeuristicModeDefault;
+        gcHeuristicSettings.heapGrowthPercent = HostConfigFlags::flags.GCHeapGrowthPercent;
+        IfJsErrorFailLog(ChakraRTInterface::JsSetRuntimeGCHeuristics(runtime, &gcHeuristicSettings));
+    }
+
     if (HostConfigFlags::flags.DebugLaunch)
     {
         Debugger* debugger = Debugger::GetDebugger(runtime);
@@ -397,6 +406,7 @@ Error:
     if (runtime != JS_INVALID_RUNTIME_HANDLE)
     {
         ChakraRTInterface::JsDisposeRuntime(runtime);
+        WScriptJsrt::ReportFinalizers();
     }
 
     _flushall();
@@ -84,6 +84,7 @@ if (!(exp)) \
 #include "Core/CommonTypedefs.h"
 #include "TestHooksRt.h"
 #include "ChakraDebug.h"
+#include "ChakraCore.h"
 
 typedef void * Var;
 
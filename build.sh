@@ -28,6 +28,7 @@ PRINT_USAGE() {
     echo "    --jobs, -j        : Multicore build (i.e. -j=3 for 3 cores)"
     echo "    --ninja, -n       : Build with ninja instead of make"
     echo "    --test-build, -t  : Test build (by default Release build)"
+    echo "    --threaded-dispatch : Dispatch interpreter opcodes with computed goto"
     echo "    --verbose, -v     : Display verbose output including all options"
     echo ""
     echo "  example:"
@@ -45,6 +46,7 @@ CMAKE_GEN=
 MAKE=make
 MULTICORE_BUILD=""
 ICU_PATH=""
+THREADED_DISPATCH=""
 
 while [[ $# -gt 0 ]]; do
     if [[ "$1" =~ "--cxx" ]]; then
@@ -70,6 +72,10 @@ while [[ $# -gt 0 ]]; do
         BUILD_TYPE="Debug"
     fi
 
+    if [[ "$1" == "--threaded-dispatch" ]]; then
+        THREADED_DISPATCH="-DTHREADED_DISPATCH_SH=1"
+    fi
+
     if [[ "$1" == "--test-build" || "$1" == "-t" ]]; then
         BUILD_TYPE="Test"
     fi
@@ -105,6 +111,7 @@ if [[ ${#_VERBOSE} > 0 ]]; then
     echo "BUILD_TYPE=${BUILD_TYPE}"
     echo "MULTICORE_BUILD=${MULTICORE_BUILD}"
     echo "ICU_PATH=${ICU_PATH}"
+    echo "THREADED_DISPATCH=${THREADED_DISPATCH}"
     echo "CMAKE_GEN=${CMAKE_GEN}"
     echo "MAKE=${MAKE}"
     echo ""
@@ -148,7 +155,7 @@ fi
 pushd BuildLinux > /dev/null
 
 echo Generating $BUILD_TYPE makefiles
-cmake $CMAKE_GEN $CC_PREFIX $ICU_PATH -DCMAKE_BUILD_TYPE=$BUILD_TYPE ..
+cmake $CMAKE_GEN $CC_PREFIX $ICU_PATH $THREADED_DISPATCH -DCMAKE_BUILD_TYPE=$BUILD_TYPE ..
 
 $MAKE $MULTICORE_BUILD 2>&1 | tee build.log
 popd > /dev/null
@@ -9,6 +9,10 @@
 #define _Analysis_assume_(expr)
 #endif
 
+#if defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
 extern void CodexAssert(bool condition);
 
 namespace utf8
@@ -60,6 +64,55 @@ namespace utf8
         return ((0x5B >> (((prefix ^ 0xF0) >> 3) & 0x1E)) & 0x03) + 1;
     }
 
+#if defined(_M_X64)
+    // SSE2 is part of x64, so these need no CPU check. Each handles the leading run of 16 code units
+    // that are all ASCII and returns how many it handled; the callers finish with the scalar paths.
+
+    inline size_t CountAsciiRun(LPCUTF8 ptr, size_t count)
+    {
+        size_t i = 0;
+        while (count - i >= 16)
+        {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr + i));
+            if (_mm_movemask_epi8(bytes) != 0) break;
+            i += 16;
+        }
+        return i;
+    }
+
+    inline size_t WidenAsciiRun(char16 *dest, LPCUTF8 ptr, size_t count)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        size_t i = 0;
+        while (count - i >= 16)
+        {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr + i));
+            if (_mm_movemask_epi8(bytes) != 0) break;
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), _mm_unpacklo_epi8(bytes, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i + 8), _mm_unpackhi_epi8(bytes, zero));
+            i += 16;
+        }
+        return i;
+    }
+
+    inline size_t NarrowAsciiRun(LPUTF8 dest, const char16 *source, size_t count)
+    {
+        const __m128i nonAsciiBits = _mm_set1_epi16((short)0xFF80);
+        const __m128i zero = _mm_setzero_si128();
+        size_t i = 0;
+        while (count - i >= 16)
+        {
+            __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+            __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i + 8));
+            __m128i nonAscii = _mm_and_si128(_mm_or_si128(low, high), nonAsciiBits);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAscii, zero)) != 0xFFFF) break;
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), _mm_packus_epi16(low, high));
+            i += 16;
+        }
+        return i;
+    }
+#endif
+
     const char16 g_chUnknown = char16(UNICODE_UNKNOWN_CHAR_MARK);
     const char16 WCH_UTF16_HIGH_FIRST  =  char16(0xd800);
     const char16 WCH_UTF16_HIGH_LAST   =  char16(0xdbff);
@@ -342,6 +395,15 @@ LFourByte:
         if (!ShouldFastPath(ptr, buffer)) goto LSlowPath;
 
 LFastPath:
+#if defined(_M_X64)
+        {
+            // cch characters take at least cch bytes, so the 16 byte loads stay inside the source
+            size_t widened = WidenAsciiRun(buffer, ptr, cch);
+            ptr += widened;
+            buffer += widened;
+            cch -= widened;
+        }
+#endif
         while (cch >= 4)
         {
             uint32 bytes = *(uint32 *)ptr;
@@ -377,6 +439,13 @@ LSlowPath:
         if (!ShouldFastPath(p, dest)) goto LSlowPath;
 
 LFastPath:
+#if defined(_M_X64)
+        {
+            size_t widened = WidenAsciiRun(dest, p, pbEnd - p);
+            p += widened;
+            dest += widened;
+        }
+#endif
         while (p + 3 < pbEnd)
         {
             unsigned bytes = *(unsigned *)p;
@@ -438,6 +507,14 @@ LSlowPath:
         if (!ShouldFastPath(dest, source)) goto LSlowPath;
 
 LFastPath:
+#if defined(_M_X64)
+        {
+            size_t narrowed = NarrowAsciiRun(dest, source, cch);
+            dest += narrowed;
+            source += narrowed;
+            cch -= (charcount_t)narrowed;
+        }
+#endif
         while (cch >= 4)
         {
             uint32 first = ((const uint32 *)source)[0];
@@ -524,6 +601,13 @@ LSlowPath:
         if (!IsAligned(pchCurrent)) goto LSlowPath;
 
 LFastPath:
+#if defined(_M_X64)
+        {
+            size_t skipped = CountAsciiRun(pchCurrent, pchEnd - pchCurrent);
+            pchCurrent += skipped;
+            i += (charcount_t)skipped;
+        }
+#endif
         // Skip 4 bytes at a time.
         while (pchCurrent < pchEndMinus4)
         {
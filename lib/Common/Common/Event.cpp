@@ -5,7 +5,6 @@
 #include "CommonCommonPch.h"
 #include "Common/Event.h"
 
-#ifdef _WIN32
 Event::Event(const bool autoReset, const bool signaled) : handle(CreateEvent(0, !autoReset, signaled, 0))
 {
     if(!handle)
@@ -19,4 +18,3 @@ bool Event::Wait(const unsigned int milliseconds) const
         Js::Throw::FatalInternalError();
     return result == WAIT_OBJECT_0;
 }
-#endif
@@ -473,7 +473,6 @@ namespace JsUtil
         // Do nothing
     }
 
-// Xplat-todo: revive BackgroundJobProcessor- we need this for the JIT
 #if ENABLE_BACKGROUND_JOB_PROCESSOR
 
     // -------------------------------------------------------------------------------------------------------------------------
@@ -1222,7 +1221,7 @@ namespace JsUtil
     unsigned int WINAPI BackgroundJobProcessor::StaticThreadProc(void *lpParam)
     {
         Assert(lpParam);
-#if !defined(_UCRT)
+#if defined(_WIN32) && !defined(_UCRT)
         HMODULE dllHandle = NULL;
         if (!GetModuleHandleEx(0, AutoSystemInfo::GetJscriptDllFileName(), &dllHandle))
         {
@@ -1257,7 +1256,7 @@ namespace JsUtil
         // may require the loader lock and if Close was called while holding the loader lock during DLL_THREAD_DETACH, it could
         // end up waiting forever, causing a deadlock.
         threadData->threadStartedOrClosing.Set();
-#if !defined(_UCRT)
+#if defined(_WIN32) && !defined(_UCRT)
         if (dllHandle)
         {
             FreeLibraryAndExitThread(dllHandle, 0);
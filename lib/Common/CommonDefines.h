@@ -128,10 +128,8 @@
 
 // GC features
 
-// Concurrent and Partial GC are disabled on non-Windows builds
-// xplat-todo: re-enable this in the future
-// These are disabled because these GC features depend on hardware
-// write-watch support that the Windows Memory Manager provides.
+// Concurrent and Partial GC depend on the write-watch support that the Windows
+// Memory Manager provides; the PAL emulates it by write protecting watched pages.
 #ifdef _WIN32
 #define SYSINFO_IMAGE_BASE_AVAILABLE 1
 #define ENABLE_CONCURRENT_GC 1
@@ -139,13 +137,15 @@
 #define ENABLE_BACKGROUND_PAGE_ZEROING 1
 #define ENABLE_BACKGROUND_PAGE_FREEING 1
 #define ENABLE_RECYCLER_TYPE_TRACKING 1
+#define ENABLE_HUGE_PAGE_SEGMENTS 0                 // Large pages need SeLockMemoryPrivilege and commit at reserve
 #else
 #define SYSINFO_IMAGE_BASE_AVAILABLE 0
-#define ENABLE_CONCURRENT_GC 0
-#define ENABLE_PARTIAL_GC 0
-#define ENABLE_BACKGROUND_PAGE_ZEROING 0
-#define ENABLE_BACKGROUND_PAGE_FREEING 0
+#define ENABLE_CONCURRENT_GC 1
+#define ENABLE_PARTIAL_GC 1
+#define ENABLE_BACKGROUND_PAGE_ZEROING 1
+#define ENABLE_BACKGROUND_PAGE_FREEING 1
 #define ENABLE_RECYCLER_TYPE_TRACKING 0
+#define ENABLE_HUGE_PAGE_SEGMENTS 1                 // 2MB aligned segments backed by transparent huge pages
 #endif
 
 #if ENABLE_BACKGROUND_PAGE_ZEROING && !ENABLE_BACKGROUND_PAGE_FREEING
@@ -159,28 +159,35 @@
 #define IDLE_DECOMMIT_ENABLED 1                     // Idle Decommit
 #define RECYCLER_PAGE_HEAP                          // PageHeap support
 
+// Background jobs
+
+// The Jobs infrastructure lives in Common and does not depend on the backend, so
+// background parsing is available with or without the JIT
+#define ENABLE_BACKGROUND_JOB_PROCESSOR 1
+#define ENABLE_BACKGROUND_PARSING 1
+
+// Interpreter features
+
+// Threaded (computed-goto) dispatch relies on the GNU labels-as-values extension
+#ifndef ENABLE_INTERPRETER_THREADED_DISPATCH
+#define ENABLE_INTERPRETER_THREADED_DISPATCH 0
+#endif
+#if ENABLE_INTERPRETER_THREADED_DISPATCH && !defined(__GNUC__)
+#error "Threaded interpreter dispatch requires a compiler that supports computed goto"
+#endif
+
 // JIT features
 
 #if DISABLE_JIT
 #define ENABLE_NATIVE_CODEGEN 0
 #define ENABLE_PROFILE_INFO 0
-#define ENABLE_BACKGROUND_JOB_PROCESSOR 0
-#define ENABLE_BACKGROUND_PARSING 0                 // Disable background parsing in this mode
-                                                    // We need to decouple the Jobs infrastructure out of
-                                                    // Backend to make background parsing work with JIT disabled
 #define DYNAMIC_INTERPRETER_THUNK 0
 #define DISABLE_DYNAMIC_PROFILE_DEFER_PARSE
 #define ENABLE_COPYONACCESS_ARRAY 0
-
-// Used to temporarily disable ASMjs related code to get nonative compiling
-#define TEMP_DISABLE_ASMJS
 #else
 // By default, enable the JIT
 #define ENABLE_NATIVE_CODEGEN 1
 #define ENABLE_PROFILE_INFO 1
-
-#define ENABLE_BACKGROUND_JOB_PROCESSOR 1
-#define ENABLE_BACKGROUND_PARSING 1
 #define ENABLE_COPYONACCESS_ARRAY 1
 #ifndef DYNAMIC_INTERPRETER_THUNK
 #if defined(_M_IX86_OR_ARM32) || defined(_M_X64_OR_ARM64)
@@ -504,6 +511,14 @@
 #endif
 #endif
 
+// The typed asm.js interpreter is entered through a per-function dynamic
+// interpreter thunk (emitted by the backend) and, on amd64, through the MASM
+// InterpreterAsmThunk/AsmJsExternalEntryPoint which assume the Windows x64
+// calling convention. Without both, asm.js modules run in the generic interpreter.
+#if !DYNAMIC_INTERPRETER_THUNK || !defined(_WIN32)
+#define TEMP_DISABLE_ASMJS
+#endif
+
 #if defined(_M_IX86) || defined(_M_X64)
 #ifndef TEMP_DISABLE_ASMJS
 #define ASMJS_PLAT
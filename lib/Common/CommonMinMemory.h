@@ -41,6 +41,7 @@ class FinalizableObject;
 #include "Memory/HeapBlockMap.h"
 #include "Memory/RecyclerObjectDumper.h"
 #include "Memory/RecyclerWeakReference.h"
+#include "Memory/RecyclerGCStats.h"
 #include "Memory/RecyclerSweep.h"
 #include "Memory/RecyclerHeuristic.h"
 #include "Memory/MarkContext.h"
@@ -270,48 +270,66 @@ typedef struct _SINGLE_LIST_ENTRY SLIST_ENTRY, *PSLIST_ENTRY;
 
 #endif // _WIN64
 
-#if defined(_AMD64_)
-
-typedef union DECLSPEC_ALIGN(16) _SLIST_HEADER {
-  struct {  // original struct
-    ULONGLONG Alignment;
-    ULONGLONG Region;
-  } DUMMYSTRUCTNAME;
-  struct {  // x64 16-byte header
-    ULONGLONG Depth : 16;
-    ULONGLONG Sequence : 48;
-    ULONGLONG Reserved : 4;
-    ULONGLONG NextEntry : 60; // last 4 bits are always 0's
-  } HeaderX64;
+// The PAL has no interlocked SLIST. The header below guards the list with a
+// spin lock instead of the ABA sequence number Windows keeps, so an entry is
+// never read after another thread has popped it (and possibly decommitted it).
+typedef struct DECLSPEC_ALIGN(16) _SLIST_HEADER {
+  PSLIST_ENTRY Next;
+  volatile LONG Lock;
+  USHORT Depth;
 } SLIST_HEADER, *PSLIST_HEADER;
 
-#elif defined(_X86_)
+inline void SListAcquireLock(IN OUT PSLIST_HEADER ListHead)
+{
+    while (__sync_lock_test_and_set(&ListHead->Lock, 1) != 0)
+    {
+        while (ListHead->Lock != 0)
+        {
+            YieldProcessor();
+        }
+    }
+}
 
-typedef union _SLIST_HEADER {
-  ULONGLONG Alignment;
-  struct {
-    SLIST_ENTRY Next;
-    WORD   Depth;
-    WORD   CpuId;
-  } DUMMYSTRUCTNAME;
-} SLIST_HEADER, *PSLIST_HEADER;
+inline void SListReleaseLock(IN OUT PSLIST_HEADER ListHead)
+{
+    __sync_lock_release(&ListHead->Lock);
+}
 
-#elif defined(_ARM_)
+inline VOID InitializeSListHead(IN OUT PSLIST_HEADER ListHead)
+{
+    ListHead->Next = NULL;
+    ListHead->Lock = 0;
+    ListHead->Depth = 0;
+}
 
-typedef union _SLIST_HEADER {
-  ULONGLONG Alignment;
-  struct {
-    SLIST_ENTRY Next;
-    WORD   Depth;
-    WORD   Reserved;
-  } DUMMYSTRUCTNAME;
-} SLIST_HEADER, *PSLIST_HEADER;
+inline PSLIST_ENTRY InterlockedPushEntrySList(IN OUT PSLIST_HEADER ListHead, IN OUT PSLIST_ENTRY ListEntry)
+{
+    SListAcquireLock(ListHead);
+    PSLIST_ENTRY first = ListHead->Next;
+    ListEntry->Next = first;
+    ListHead->Next = ListEntry;
+    ListHead->Depth++;
+    SListReleaseLock(ListHead);
+    return first;
+}
 
-#endif
+inline PSLIST_ENTRY InterlockedPopEntrySList(IN OUT PSLIST_HEADER ListHead)
+{
+    SListAcquireLock(ListHead);
+    PSLIST_ENTRY first = ListHead->Next;
+    if (first != NULL)
+    {
+        ListHead->Next = first->Next;
+        ListHead->Depth--;
+    }
+    SListReleaseLock(ListHead);
+    return first;
+}
 
-PALIMPORT VOID PALAPI InitializeSListHead(IN OUT PSLIST_HEADER ListHead);
-PALIMPORT PSLIST_ENTRY PALAPI InterlockedPushEntrySList(IN OUT PSLIST_HEADER ListHead, IN OUT PSLIST_ENTRY  ListEntry);
-PALIMPORT PSLIST_ENTRY PALAPI InterlockedPopEntrySList(IN OUT PSLIST_HEADER ListHead);
+inline USHORT QueryDepthSList(IN PSLIST_HEADER ListHead)
+{
+    return ListHead->Depth;
+}
 
 
 template <class T>
@@ -349,7 +367,7 @@ inline __int64 _abs64(__int64 n)
     return n < 0 ? -n : n;
 }
 
-// xplat-todo: implement these for JIT and Concurrent/Partial GC
+// Implemented in the PAL (thread.cpp)
 uintptr_t _beginthreadex(
    void *security,
    unsigned stack_size,
@@ -358,6 +376,7 @@ uintptr_t _beginthreadex(
    unsigned initflag,
    unsigned *thrdaddr);
 
+// xplat-todo: implement this for the JIT
 BOOL WINAPI GetModuleHandleEx(
   _In_     DWORD   dwFlags,
   _In_opt_ LPCTSTR lpModuleName,
@@ -250,6 +250,7 @@ PHASE(All)
                 PHASE(BackgroundFinishMark)
             PHASE(ConcurrentPartialCollect)
             PHASE(ParallelMark)
+            PHASE(ParallelSweep)
             PHASE(PartialCollect)
                 PHASE(ResetMarks)
                 PHASE(ResetWriteWatch)
@@ -258,6 +259,7 @@ PHASE(All)
                     PHASE(FindImplicitRoot)
                     PHASE(FindRootExt)
                 PHASE(ScanStack)
+                    PHASE(PreciseStackFrames)
                 PHASE(ConcurrentMark)
                 PHASE(ConcurrentWait)
                 PHASE(Rescan)
@@ -625,6 +627,9 @@ PHASE(All)
 #endif
 
 #define DEFAULT_CONFIG_RecyclerForceMarkInterior (false)
+#define DEFAULT_CONFIG_RecyclerMaxParallelism (16)      // Threads marking in parallel, including the main and concurrent threads
+#define DEFAULT_CONFIG_RecyclerHeapGrowthPercent (100)
+#define DEFAULT_CONFIG_RecyclerPauseTimePercent (5)
 
 #define DEFAULT_CONFIG_MemProtectHeap (false)
 
@@ -742,6 +747,8 @@ FLAGNR(Boolean, ArenaNoFreeList       , "Do not free list in arena", false)
 FLAGNR(Boolean, ArenaNoPageReuse      , "Do not reuse page in arena", false)
 FLAGNR(Boolean, ArenaUseHeapAlloc     , "Arena use heap to allocate memory instead of page allocator", false)
 #endif
+FLAGR (Number,  CompileArenaRetainedBytes, "Most bytes of pages a pooled parser or byte code arena keeps between compiles (0 disables the pool)", 256 * 1024)
+FLAGR (Boolean, Latin1Strings         , "Store host strings whose characters all fit in one byte one byte per character until they need to be widened", true)
 FLAGNR(Boolean, ValidateInlineStack, "Does a stack walk on helper calls to validate inline stack is correctly restored", false)
 FLAGNR(Boolean, AsmDiff               , "Dump the IR without memory locations and varying parameters.", false)
 FLAGNR(String,  AsmDumpMode           , "Dump the final assembly to a file without memory locations and varying parameters\n\t\t\t\t\tThe 'filename' is the file where the assembly will be dumped. Dump to console if no file is specified", nullptr)
@@ -1172,6 +1179,13 @@ FLAGNR(Phases,  RecyclerVerify         , "Verify recycler memory", )
 FLAGNR(Number,  RecyclerVerifyPadSize  , "Padding size to verify recycler memory", 12)
 #endif
 FLAGNR(Boolean, RecyclerTest           , "Run recycler tests instead of executing script", false)
+FLAGR (Boolean, RecyclerAdaptiveHeuristic, "Size the next collection from the live heap and the allocation rate instead of collecting every 1MB", false)
+FLAGNR(Number,  RecyclerHeapGrowthPercent, "With -RecyclerAdaptiveHeuristic, collect again once the heap grew by this percentage of what was live", DEFAULT_CONFIG_RecyclerHeapGrowthPercent)
+FLAGNR(Number,  RecyclerPauseTimePercent, "With -RecyclerAdaptiveHeuristic, space collections out so pauses take at most this percentage of the time", DEFAULT_CONFIG_RecyclerPauseTimePercent)
+FLAGR (Boolean, RecyclerHugePageSegments, "Carve recycler page segments out of 2MB aligned runs backed by transparent huge pages where supported; these segments aren't write watched, so concurrent and partial collection are turned off", false)
+FLAGR (Boolean, RecyclerDiscardFreeObjectPages, "Return the physical pages inside freed medium leaf and large objects to the OS during sweep", false)
+FLAGR (Number,  RecyclerMaxParallelism, "Maximum number of threads (including the main and concurrent threads) to mark and sweep with in parallel", DEFAULT_CONFIG_RecyclerMaxParallelism)
+FLAGR (Boolean, RecyclerBackgroundFinalize, "Run finalizers that don't need the script thread in batches on a background thread after sweep", true)
 FLAGNR(Boolean, RecyclerProtectPagesOnRescan, "Temporarily switch all pages to read only during rescan", false)
 #ifdef RECYCLER_VERIFY_MARK
 FLAGNR(Boolean, RecyclerVerifyMark    , "verify concurrent gc", false)
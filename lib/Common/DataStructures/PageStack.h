@@ -5,13 +5,14 @@
 template <typename T>
 class PageStack
 {
-private:
+public:
     struct Chunk : public PagePoolPage
     {
         Chunk * nextChunk;
         T entries[];
     };
 
+private:
     static const size_t EntriesPerChunk = (AutoSystemInfo::PageSize - sizeof(Chunk)) / sizeof(T);
 
 public:
@@ -26,6 +27,11 @@ public:
 
     uint Split(uint targetCount, __in_ecount(targetCount) PageStack<T> ** targetStacks);
 
+    // Every chunk below the current one is full, so it can be handed to another stack as a unit
+    bool HasFullChunk() const { return currentChunk != nullptr && currentChunk->nextChunk != nullptr; }
+    Chunk * DetachFullChunk();
+    void AttachFullChunk(Chunk * chunk);
+
     void Abort();
     void Release();
 
@@ -44,7 +50,7 @@ public:
     }
 #endif
 
-    static const uint MaxSplitTargets = 3;     // Not counting original stack, so this supports 4-way parallel
+    static const uint MaxSplitTargets = 63;    // Not counting original stack, so this supports 64-way parallel
 
 private:
     Chunk * CreateChunk();
@@ -353,6 +359,53 @@ uint PageStack<T>::Split(uint targetCount, __in_ecount(targetCount) PageStack<T>
 }
 
 
+template <typename T>
+typename PageStack<T>::Chunk * PageStack<T>::DetachFullChunk()
+{
+    Assert(HasFullChunk());
+
+    // Take the chunk just below the current one; the entries we are popping from stay put.
+    Chunk * chunk = currentChunk->nextChunk;
+    currentChunk->nextChunk = chunk->nextChunk;
+    chunk->nextChunk = nullptr;
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    this->pageCount--;
+#endif
+#if DBG
+    this->count -= EntriesPerChunk;
+#endif
+
+    return chunk;
+}
+
+
+template <typename T>
+void PageStack<T>::AttachFullChunk(Chunk * chunk)
+{
+    Assert(IsEmpty());
+    Assert(chunk != nullptr && chunk->nextChunk == nullptr);
+
+    // Pop assumes every chunk below the current one is full, so the (empty) current chunk can't stay underneath.
+    if (currentChunk != nullptr)
+    {
+        FreeChunk(currentChunk);
+    }
+
+    currentChunk = chunk;
+    chunkStart = chunk->entries;
+    chunkEnd = &chunk->entries[EntriesPerChunk];
+    nextEntry = chunkEnd;
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    this->pageCount++;
+#endif
+#if DBG
+    this->count = EntriesPerChunk;
+#endif
+}
+
+
 template <typename T>
 void PageStack<T>::Abort()
 {
@@ -398,6 +398,70 @@ FullReset()
     }
 }
 
+template <class TFreeListPolicy, size_t ObjectAlignmentBitShiftArg, bool RequireObjectAlignment, size_t MaxObjectSize>
+void
+ArenaAllocatorBase<TFreeListPolicy, ObjectAlignmentBitShiftArg, RequireObjectAlignment, MaxObjectSize>::
+ResetRetainingPages(size_t maxRetainedBytes)
+{
+    ASSERT_THREAD();
+    Assert(!lockBlockList);
+
+#ifdef ARENA_MEMORY_VERIFY
+    if (Js::Configuration::Global.flags.ArenaNoPageReuse)
+    {
+        maxRetainedBytes = 0;
+    }
+#endif
+    if (maxRetainedBytes == 0)
+    {
+#ifdef PROFILE_MEM
+        LogReset();
+#endif
+        Clear();
+        return;
+    }
+
+    // Take the page blocks off the lists so that Clear only frees the heap blocks
+    BigBlock * blockList = this->fullBlocks;
+    BigBlock * blockp = this->bigBlocks;
+    while (blockp != nullptr)
+    {
+        BigBlock * nextBlock = blockp->nextBigBlock;
+        blockp->nextBigBlock = blockList;
+        blockList = blockp;
+        blockp = nextBlock;
+    }
+    this->bigBlocks = nullptr;
+    this->fullBlocks = nullptr;
+
+#ifdef PROFILE_MEM
+    LogReset();
+#endif
+    Clear();
+
+    size_t retainedBytes = 0;
+    while (blockList != nullptr)
+    {
+        BigBlock * nextBlock = blockList->nextBigBlock;
+        if (retainedBytes + blockList->nbytes <= maxRetainedBytes)
+        {
+            // Each block pushed on the list leaves the previous one as a hole SnailAlloc can fill
+            retainedBytes += blockList->nbytes;
+            blockList->currentByte = 0;
+            this->blockState++;
+            SetCacheBlock(blockList);
+#ifdef PROFILE_MEM
+            LogRealAlloc(blockList->allocation->GetSize() + sizeof(PageAllocation));
+#endif
+        }
+        else
+        {
+            GetPageAllocator()->ReleaseAllocation(blockList->allocation);
+        }
+        blockList = nextBlock;
+    }
+}
+
 template <class TFreeListPolicy, size_t ObjectAlignmentBitShiftArg, bool RequireObjectAlignment, size_t MaxObjectSize>
 void
 ArenaAllocatorBase<TFreeListPolicy, ObjectAlignmentBitShiftArg, RequireObjectAlignment, MaxObjectSize>::
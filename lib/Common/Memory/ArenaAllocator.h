@@ -188,6 +188,9 @@ public:
         FullReset();
     }
 
+    // Like Reset, but keeps emptied page blocks, up to maxRetainedBytes of them, for the next allocations
+    void ResetRetainingPages(size_t maxRetainedBytes);
+
     void Move(ArenaAllocatorBase *srcAllocator);
 
     void Clear()
@@ -1029,7 +1029,8 @@ SmallHeapBlockT<TBlockAttributes>::Sweep(RecyclerSweep& recyclerSweep, bool queu
     Assert(!this->IsLeafBlock() || finalizeCount == 0);
 
     Recycler * recycler = recyclerSweep.GetRecycler();
-    RECYCLER_STATS_INC(recycler, heapBlockCount[this->GetHeapBlockType()]);
+    RECYCLER_STATS_INTERLOCKED_INC(recycler, heapBlockCount[this->GetHeapBlockType()]);
+    recyclerSweep.AddSweepBytes(this->GetHeapBlockType(), localMarkCount * this->objectSize, expectSweepCount * this->objectSize);
 
 #if ENABLE_PARTIAL_GC
     if (recyclerSweep.DoAdjustPartialHeuristics() && allocable)
@@ -1051,7 +1052,7 @@ SmallHeapBlockT<TBlockAttributes>::Sweep(RecyclerSweep& recyclerSweep, bool queu
         return SweepStateEmpty;
     }
 
-    RECYCLER_STATS_ADD(recycler, heapBlockFreeByteCount[this->GetHeapBlockType()], expectFreeCount * this->objectSize);
+    RECYCLER_STATS_INTERLOCKED_ADD(recycler, heapBlockFreeByteCount[this->GetHeapBlockType()], expectFreeCount * this->objectSize);
 
     Assert(!hasPendingDispose || (this->freeCount != 0));
     SweepState state = SweepStateSwept;
@@ -1067,7 +1068,7 @@ SmallHeapBlockT<TBlockAttributes>::Sweep(RecyclerSweep& recyclerSweep, bool queu
         return (this->freeCount == 0) ? SweepStateFull : state;
     }
 
-    RECYCLER_STATS_INC(recycler, heapBlockSweptCount[this->GetHeapBlockType()]);
+    RECYCLER_STATS_INTERLOCKED_INC(recycler, heapBlockSweptCount[this->GetHeapBlockType()]);
 
     // We need to sweep in thread if there are any finalizable object.
     // So that the PrepareFinalize() can be called before concurrent sweep
@@ -1086,7 +1087,7 @@ SmallHeapBlockT<TBlockAttributes>::Sweep(RecyclerSweep& recyclerSweep, bool queu
         Assert(!this->HasPendingDisposeObjects());
 
         recyclerSweep.SetHasPendingSweepSmallHeapBlocks();
-        RECYCLER_STATS_INC(recycler, heapBlockConcurrentSweptCount[this->GetHeapBlockType()]);
+        RECYCLER_STATS_INTERLOCKED_INC(recycler, heapBlockConcurrentSweptCount[this->GetHeapBlockType()]);
         // This heap block has objects that need to be swept concurrently.
         this->isPendingConcurrentSweep = true;
         return SweepStatePendingSweep;
@@ -1155,7 +1156,7 @@ SmallHeapBlockT<TBlockAttributes>::SweepObjects(Recycler * recycler)
     {
         Assert(IsValidBitIndex(bitIndex));
 
-        RECYCLER_STATS_ADD(recycler, objectSweepScanCount, !isForceSweeping);
+        RECYCLER_STATS_INTERLOCKED_ADD(recycler, objectSweepScanCount, !isForceSweeping);
         if (!marked->Test(bitIndex))
         {
             if (!this->GetFreeBitVector()->Test(bitIndex))
@@ -1248,6 +1249,12 @@ SmallHeapBlockT<TBlockAttributes>::EnqueueProcessedObject(FreeObject ** list, vo
     freeObject->SetNext(*list);
     *list = freeObject;
 
+    // Leaf allocations don't expect zeroed memory, so the pages past the link can go
+    if (TBlockAttributes::IsMediumBlock && this->IsLeafBlock() && this->heapBucket->heapInfo->recycler->IsDiscardFreeObjectPagesEnabled())
+    {
+        this->heapBucket->heapInfo->recycler->DiscardFreeObjectPages((char *)(freeObject + 1), objectSize - sizeof(FreeObject));
+    }
+
     // clear the attributes so that when we are allocating a leaf, we don't have to set the attribute
     this->ObjectInfo(index) = 0;
 }
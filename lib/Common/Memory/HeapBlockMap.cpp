@@ -614,6 +614,13 @@ HeapBlockMap32::ResetWriteWatch(Recycler * recycler)
         if (segmentPageAllocator == recycler->GetRecyclerPageAllocator() ||
             segmentPageAllocator == recycler->GetRecyclerLargeBlockPageAllocator())
         {
+#if ENABLE_HUGE_PAGE_SEGMENTS
+            if (segmentPageAllocator->HasHugePageSegments())
+            {
+                // Not write watched, see RecyclerPageAllocator::EnableWriteWatch
+                return;
+            }
+#endif
             // Call ResetWriteWatch for Small non-leaf and Large segments.
             UINT ret = ::ResetWriteWatch(segmentStart, segmentLength);
             Assert(ret == 0);
@@ -859,6 +866,23 @@ HeapBlockMap32::Rescan(Recycler * recycler, bool resetWriteWatch)
         // Large blocks have their own separate write watch handling.
         if (segmentPageAllocator == recycler->GetRecyclerPageAllocator())
         {
+#if ENABLE_HUGE_PAGE_SEGMENTS
+            if (segmentPageAllocator->HasHugePageSegments())
+            {
+                // Huge page segments aren't write watched (see RecyclerPageAllocator::EnableWriteWatch),
+                // so every page has to be considered dirty.
+                size_t pageCount = segmentLength / AutoSystemInfo::PageSize;
+                for (size_t i = 0; i < pageCount; i++)
+                {
+                    if (RescanPage(segmentStart + (i * AutoSystemInfo::PageSize), &anyObjectsScannedOnPage, recycler) && anyObjectsScannedOnPage)
+                    {
+                        scannedPageCount++;
+                    }
+                }
+                return;
+            }
+#endif
+
             // array for WW results
             void * dirtyPageAddresses[MaxGetWriteWatchPages];
 
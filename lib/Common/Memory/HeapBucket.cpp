@@ -440,7 +440,7 @@ HeapBucketT<TBlockType>::SnailAlloc(Recycler * recycler, TBlockAllocatorType * a
         // Can't even allocate a new block, we need force a collection and
         //allocate some free memory, add a new heap block again, or throw out of memory
         AllocationVerboseTrace(recycler->GetRecyclerFlagsTable(), _u("TryAllocFromNewHeapBlock failed, forcing in-thread collection\n"));
-        recycler->CollectNow<CollectNowForceInThread>();
+        recycler->CollectNow<CollectOnAllocationFailure>();
     }
 
     // Collection might trigger finalizer, which might allocate memory. So the allocator
@@ -836,7 +836,7 @@ HeapBucketT<TBlockType>::SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlock
             }
 #endif
 
-            RECYCLER_STATS_INC(recycler, numEmptySmallBlocks[heapBlock->GetHeapBlockType()]);
+            RECYCLER_STATS_INTERLOCKED_INC(recycler, numEmptySmallBlocks[heapBlock->GetHeapBlockType()]);
 
 #if ENABLE_CONCURRENT_GC
             // CONCURRENT-TODO: Finalizable block never have background == true and always be processed
@@ -851,7 +851,11 @@ HeapBucketT<TBlockType>::SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlock
                 // CONCURRENT-TODO: We will zero heap block even if the number free page pool exceed
                 // the maximum and will get decommitted anyway
                 recyclerSweep.template QueueEmptyHeapBlock<TBlockType>(this, heapBlock);
-                RECYCLER_STATS_INC(recycler, numZeroedOutSmallBlocks);
+                RECYCLER_STATS_INTERLOCKED_INC(recycler, numZeroedOutSmallBlocks);
+            }
+            else if (recyclerSweep.IsParallel())
+            {
+                recyclerSweep.template QueueParallelEmptyHeapBlock<TBlockType>(this, heapBlock);
             }
             else
 #endif
@@ -1427,6 +1431,18 @@ HeapBucketGroup<TBlockAttributes>::TransferPendingEmptyHeapBlocks(RecyclerSweep&
 #endif
     recyclerSweep.TransferPendingEmptyHeapBlocks(&finalizableHeapBucket);
 }
+
+template <class TBlockAttributes>
+void
+HeapBucketGroup<TBlockAttributes>::FreeParallelEmptyHeapBlocks(RecyclerSweep& recyclerSweep)
+{
+    // Only the non-finalizable buckets are swept in parallel
+    recyclerSweep.FreeParallelEmptyHeapBlocks(&heapBucket);
+    recyclerSweep.FreeParallelEmptyHeapBlocks(&leafHeapBucket);
+#ifdef RECYCLER_WRITE_BARRIER
+    recyclerSweep.FreeParallelEmptyHeapBlocks(&smallNormalWithBarrierHeapBucket);
+#endif
+}
 #endif
 
 #if DBG || defined(RECYCLER_SLOW_CHECK_ENABLED)
@@ -103,6 +103,7 @@ public:
     friend class SmallFinalizableHeapBlockT;
 
     friend class LargeHeapBlock;
+    friend class HeapInfo;
 #ifdef RECYCLER_WRITE_BARRIER
     template <typename TBlockAttributes>
     friend class SmallFinalizableWithBarrierHeapBlockT;
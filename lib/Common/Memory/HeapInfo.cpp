@@ -1024,27 +1024,63 @@ HeapInfo::SweepSmallNonFinalizable(RecyclerSweep& recyclerSweep)
         // until  we are going to sweep leaf pages.
         recycler->GetRecyclerLeafPageAllocator()->SuspendIdleDecommit();
     }
-    for (uint i=0; i<HeapConstants::BucketCount; i++)
+
+#if ENABLE_CONCURRENT_GC
+    if (!recycler->DoParallelSweep(recyclerSweep))
+#endif
+    {
+        this->SweepSmallNonFinalizableBuckets(recyclerSweep, 0, 1);
+    }
+
+    if (!recyclerSweep.IsBackground())
+    {
+        // large block don't use the leaf page allocator, we can resume idle decommit now
+        recycler->GetRecyclerLeafPageAllocator()->ResumeIdleDecommit();
+
+        RECYCLER_SLOW_CHECK(VerifySmallHeapBlockCount());
+        RECYCLER_SLOW_CHECK(VerifyLargeHeapBlockCount());
+    }
+}
+
+// Sweep every parallelCount-th bucket starting at parallelId. Buckets share no sweep state, so
+// parallel sweepers each take a different parallelId.
+void
+HeapInfo::SweepSmallNonFinalizableBuckets(RecyclerSweep& recyclerSweep, uint parallelId, uint parallelCount)
+{
+    Assert(parallelId < parallelCount);
+
+    for (uint i = parallelId; i < HeapConstants::BucketCount; i += parallelCount)
     {
         heapBuckets[i].Sweep(recyclerSweep);
     }
 
 #if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
-    for (uint i = 0; i < HeapConstants::MediumBucketCount; i++)
+    for (uint i = parallelId; i < HeapConstants::MediumBucketCount; i += parallelCount)
     {
         mediumHeapBuckets[i].Sweep(recyclerSweep);
     }
 #endif
+}
 
-    if (!recyclerSweep.IsBackground())
+#if ENABLE_CONCURRENT_GC
+void
+HeapInfo::FreeParallelEmptyHeapBlocks(RecyclerSweep& recyclerSweep)
+{
+    Assert(!recyclerSweep.IsBackground());
+
+    for (uint i = 0; i < HeapConstants::BucketCount; i++)
     {
-        // large block don't use the leaf page allocator, we can resume idle decommit now
-        recycler->GetRecyclerLeafPageAllocator()->ResumeIdleDecommit();
+        heapBuckets[i].FreeParallelEmptyHeapBlocks(recyclerSweep);
+    }
 
-        RECYCLER_SLOW_CHECK(VerifySmallHeapBlockCount());
-        RECYCLER_SLOW_CHECK(VerifyLargeHeapBlockCount());
+#if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
+    for (uint i = 0; i < HeapConstants::MediumBucketCount; i++)
+    {
+        mediumHeapBuckets[i].FreeParallelEmptyHeapBlocks(recyclerSweep);
     }
+#endif
 }
+#endif
 
 size_t
 HeapInfo::Rescan(RescanFlags flags)
@@ -266,6 +266,10 @@ private:
 #endif
 
     void SweepSmallNonFinalizable(RecyclerSweep& recyclerSweep);
+    void SweepSmallNonFinalizableBuckets(RecyclerSweep& recyclerSweep, uint parallelId, uint parallelCount);
+#if ENABLE_CONCURRENT_GC
+    void FreeParallelEmptyHeapBlocks(RecyclerSweep& recyclerSweep);
+#endif
     void SweepLargeNonFinalizable(RecyclerSweep& recyclerSweep);
 
 #if DBG || defined(RECYCLER_SLOW_CHECK_ENABLED)
@@ -1306,13 +1306,16 @@ LargeHeapBlock::Sweep(RecyclerSweep& recyclerSweep, bool queuePendingSweep)
 {
     Recycler * recycler = recyclerSweep.GetRecycler();
 
-    uint markCount = GetMarkCount();
+    size_t markedBytes;
+    size_t unmarkedBytes;
+    uint markCount = GetMarkCount(&markedBytes, &unmarkedBytes);
 #if DBG
     Assert(this->lastCollectAllocCount == this->allocCount);
     Assert(markCount <= allocCount);
 #endif
 
     RECYCLER_STATS_INC(recycler, heapBlockCount[HeapBlock::LargeBlockType]);
+    recyclerSweep.AddSweepBytes(HeapBlock::LargeBlockType, markedBytes, unmarkedBytes);
 
 #if DBG
     this->expectedSweepCount = allocCount - markCount;
@@ -1677,6 +1680,16 @@ LargeHeapBlock::SweepObjects(Recycler * recycler)
             entry->next = head;
             entry->objectSize = objectSize;
             this->freeList.entries = entry;
+
+            if (recycler->IsDiscardFreeObjectPagesEnabled()
+#if ENABLE_PARTIAL_GC && ENABLE_CONCURRENT_GC
+                // Partial sweep leaves the memory of the objects it frees alone
+                && mode != SweepMode_ConcurrentPartial
+#endif
+                )
+            {
+                recycler->DiscardFreeObjectPages((char *)header->GetAddress(), objectSize);
+            }
         }
 
 #if DBG
@@ -1895,20 +1908,38 @@ LargeHeapBlock::Verify(Recycler * recycler)
 #endif
 
 uint
-LargeHeapBlock::GetMarkCount()
+LargeHeapBlock::GetMarkCount(size_t * markedBytes, size_t * unmarkedBytes)
 {
     uint markCount = 0;
+    size_t localMarkedBytes = 0;
+    size_t localUnmarkedBytes = 0;
     const HeapBlockMap& heapBlockMap = this->heapInfo->recycler->heapBlockMap;
 
     for (uint i = 0; i < allocCount; i++)
     {
         LargeObjectHeader* header = this->HeaderList()[i];
-        if (header && header->objectIndex == i && heapBlockMap.IsMarked(header->GetAddress()))
+        if (header && header->objectIndex == i)
         {
-            markCount++;
+            if (heapBlockMap.IsMarked(header->GetAddress()))
+            {
+                markCount++;
+                localMarkedBytes += header->objectSize;
+            }
+            else
+            {
+                localUnmarkedBytes += header->objectSize;
+            }
         }
     }
 
+    if (markedBytes != nullptr)
+    {
+        *markedBytes = localMarkedBytes;
+    }
+    if (unmarkedBytes != nullptr)
+    {
+        *unmarkedBytes = localUnmarkedBytes;
+    }
     return markCount;
 }
 
@@ -196,7 +196,8 @@ private:
         return header;
     }
 
-    uint GetMarkCount();
+    // Optionally also sums the sizes of the marked and unmarked objects
+    uint GetMarkCount(size_t * markedBytes = nullptr, size_t * unmarkedBytes = nullptr);
     bool GetObjectHeader(void* objectAddress, LargeObjectHeader** ppHeader);
     BOOL IsNewHeapBlock() const { return lastCollectAllocCount == 0; }
     static size_t GetAllocPlusSize(uint objectCount);
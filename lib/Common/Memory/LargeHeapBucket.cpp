@@ -81,7 +81,7 @@ LargeHeapBucket::SnailAlloc(Recycler * recycler, size_t sizeCat, size_t size, Ob
         // Can't even allocate a new block, we need force a collection and
         // allocate some free memory, add a new heap block again, or throw out of memory
         AllocationVerboseTrace(recycler->GetRecyclerFlagsTable(), _u("LargeHeapBucket::AddLargeHeapBlock failed, forcing in-thread collection\n"));
-        recycler->CollectNow<CollectNowForceInThread>();
+        recycler->CollectNow<CollectOnAllocationFailure>();
     }
 
     memBlock = TryAlloc(recycler, sizeCat, attributes);
@@ -100,5 +100,94 @@ void MarkContext::ProcessTracked()
     trackStack.Release();
 }
 
+#if ENABLE_CONCURRENT_GC
+ParallelMarkWorkQueue::ParallelMarkWorkQueue() :
+    chunks(nullptr),
+    chunkCount(0),
+    idleWorkerCount(0),
+    workerCount(0)
+{
+}
+
+
+ParallelMarkWorkQueue::~ParallelMarkWorkQueue()
+{
+    Assert(chunks == nullptr);
+    Assert(workerCount == 0);
+}
+
+
+void ParallelMarkWorkQueue::Join()
+{
+    AutoCriticalSection autocs(&cs);
+    this->workerCount++;
+}
+
+
+void ParallelMarkWorkQueue::ShareWork(MarkContext * markContext)
+{
+    AutoCriticalSection autocs(&cs);
+
+    // Keep one queued chunk per idle worker; the current chunk always stays with its owner.
+    while (this->chunkCount < this->idleWorkerCount && markContext->markStack.HasFullChunk())
+    {
+        Chunk * chunk = markContext->markStack.DetachFullChunk();
+        chunk->nextChunk = this->chunks;
+        this->chunks = chunk;
+        this->chunkCount++;
+    }
+}
 
 
+bool ParallelMarkWorkQueue::WaitForWork(MarkContext * markContext)
+{
+    Assert(!markContext->HasPendingMarkObjects());
+
+    {
+        AutoCriticalSection autocs(&cs);
+        this->idleWorkerCount++;
+    }
+
+    while (true)
+    {
+        {
+            AutoCriticalSection autocs(&cs);
+
+            if (this->chunks != nullptr)
+            {
+                Chunk * chunk = this->chunks;
+                this->chunks = chunk->nextChunk;
+                this->chunkCount--;
+                this->idleWorkerCount--;
+
+                chunk->nextChunk = nullptr;
+                markContext->markStack.AttachFullChunk(chunk);
+                return true;
+            }
+
+            // Only busy workers share work, so once they are all idle nothing more can show up.
+            // Workers that join later just mark on their own until somebody else waits for work.
+            if (this->idleWorkerCount == this->workerCount)
+            {
+                this->idleWorkerCount--;
+                this->workerCount--;
+                return false;
+            }
+        }
+
+        // Wait for the queue to change without holding the lock
+        for (uint i = 0; this->chunks == nullptr && this->idleWorkerCount != this->workerCount; i++)
+        {
+            if (i < SpinCount)
+            {
+                YieldProcessor();
+            }
+            else
+            {
+                SwitchToThread();
+                i = 0;
+            }
+        }
+    }
+}
+#endif
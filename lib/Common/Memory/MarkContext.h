@@ -5,11 +5,17 @@
 namespace Memory
 {
 class Recycler;
+#if ENABLE_CONCURRENT_GC
+class ParallelMarkWorkQueue;
+#endif
 
 typedef JsUtil::SynchronizedDictionary<void *, void *, NoCheckHeapAllocator, PrimeSizePolicy, RecyclerPointerComparer, JsUtil::SimpleDictionaryEntry, Js::DefaultContainerLockPolicy, CriticalSection> MarkMap;
 
 class MarkContext
 {
+#if ENABLE_CONCURRENT_GC
+    friend class ParallelMarkWorkQueue;
+#endif
 private:
     struct MarkCandidate
     {
@@ -109,7 +115,38 @@ private:
 
     void OnObjectMarked(void* object, void* parent);
 #endif
+#if ENABLE_CONCURRENT_GC
+    void ShareMarkWork();
+#endif
 };
 
+#if ENABLE_CONCURRENT_GC
+// Balances a parallel mark across the mark contexts taking part in it.
+// While some participant is out of work, a busy context hands full chunks of its mark stack to the queue,
+// and idle participants adopt them. Participants leave once all of them are idle and the queue is empty.
+class ParallelMarkWorkQueue
+{
+public:
+    ParallelMarkWorkQueue();
+    ~ParallelMarkWorkQueue();
+
+    void Join();
+    bool NeedsWork() const { return this->idleWorkerCount > this->chunkCount; }
+    void ShareWork(MarkContext * markContext);
+    bool WaitForWork(MarkContext * markContext);
+
+private:
+    typedef PageStack<MarkContext::MarkCandidate>::Chunk Chunk;
+
+    static const uint SpinCount = 1024;
+
+    CriticalSection cs;
+    Chunk * volatile chunks;
+    uint volatile chunkCount;
+    uint volatile idleWorkerCount;
+    uint volatile workerCount;
+};
+#endif
+
 
 }
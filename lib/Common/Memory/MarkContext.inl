@@ -159,6 +159,18 @@ void MarkContext::MarkTrackedObject(FinalizableObject * trackedObject)
     END_NO_EXCEPTION
 }
 
+#if ENABLE_CONCURRENT_GC
+inline
+void MarkContext::ShareMarkWork()
+{
+    // Only take the queue's lock when we have a spare chunk and some other context has run dry
+    if (markStack.HasFullChunk() && recycler->parallelMarkWorkQueue.NeedsWork())
+    {
+        recycler->parallelMarkWorkQueue.ShareWork(this);
+    }
+}
+#endif
+
 template <bool parallel, bool interior>
 inline
 void MarkContext::ProcessMark()
@@ -189,6 +201,13 @@ void MarkContext::ProcessMark()
             ScanObject<parallel, interior>(current.obj, current.byteCount);
 
             current = next;
+
+#if ENABLE_CONCURRENT_GC
+            if (parallel)
+            {
+                ShareMarkWork();
+            }
+#endif
         }
 
         // The stack is empty, but we still have a previously retrieved entry; process it now.
@@ -205,6 +224,13 @@ void MarkContext::ProcessMark()
     while (markStack.Pop(&current))
     {
         ScanObject<parallel, interior>(current.obj, current.byteCount);
+
+#if ENABLE_CONCURRENT_GC
+        if (parallel)
+        {
+            ShareMarkWork();
+        }
+#endif
     }
 #endif
 
@@ -581,6 +581,9 @@ PageAllocatorBase<T>::PageAllocatorBase(AllocationPolicyManager * policyManager,
     disableAllocationOutOfMemory(false),
     secondaryAllocPageCount(secondaryAllocPageCount),
     excludeGuardPages(excludeGuardPages),
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    hugePageSegments(false),
+#endif
     virtualAllocator(nullptr),
     type(type)
     , reservedBytes(0)
@@ -702,6 +705,24 @@ PageAllocatorBase<T>::AllocPagesForBytes(size_t requestBytes)
     return this->AllocAllocation(pages);
 }
 
+#if ENABLE_HUGE_PAGE_SEGMENTS
+template<typename T>
+void
+PageAllocatorBase<T>::EnableHugePageSegments()
+{
+    // Segments already allocated keep their size, so this has to happen before the first one
+    Assert(segments.Empty());
+    Assert(fullSegments.Empty());
+    Assert(emptySegments.Empty());
+    Assert(decommitSegments.Empty());
+    Assert(secondaryAllocPageCount == 0);
+
+    // Full size segments, so that two of them share each 2MB huge page the PAL reserves for MEM_LARGE_PAGES
+    this->maxAllocPageCount = PageSegmentBase<T>::MaxDataPageCount;
+    this->hugePageSegments = true;
+}
+#endif
+
 template<typename T>
 PageSegmentBase<T> *
 PageAllocatorBase<T>::AllocPageSegment(DListBase<PageSegmentBase<T>>& segmentList, PageAllocatorBase<T> * pageAllocator, bool committed, bool allocated)
@@ -713,7 +734,18 @@ PageAllocatorBase<T>::AllocPageSegment(DListBase<PageSegmentBase<T>>& segmentLis
         return nullptr;
     }
 
-    if (!segment->Initialize((committed ? MEM_COMMIT : 0) | pageAllocator->allocFlags, pageAllocator->excludeGuardPages))
+    DWORD segmentAllocFlags = (committed ? MEM_COMMIT : 0) | pageAllocator->allocFlags;
+    bool segmentExcludeGuardPages = pageAllocator->excludeGuardPages;
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    if (pageAllocator->hugePageSegments)
+    {
+        // Guard pages would push the segment off the huge page boundary
+        segmentAllocFlags |= MEM_LARGE_PAGES;
+        segmentExcludeGuardPages = true;
+    }
+#endif
+
+    if (!segment->Initialize(segmentAllocFlags, segmentExcludeGuardPages))
     {
         segmentList.RemoveHead(&NoThrowNoMemProtectHeapAllocator::Instance);
         return nullptr;
@@ -1554,7 +1586,15 @@ PageAllocatorBase<T>::ZeroQueuedPages()
         }
         PageSegmentBase<T> * segment = freePageEntry->segment;
         uint pageCount = freePageEntry->pageCount;
-        memset(freePageEntry, 0, pageCount * AutoSystemInfo::PageSize);
+#ifndef _WIN32
+        // Large runs are unlikely to be reused right away; hand their physical pages
+        // back to the OS rather than touching every byte.
+        if (pageCount < MinDiscardZeroPageCount ||
+            !PAL_VirtualZeroMemory(freePageEntry, pageCount * AutoSystemInfo::PageSize))
+#endif
+        {
+            memset(freePageEntry, 0, pageCount * AutoSystemInfo::PageSize);
+        }
         QueuePages(freePageEntry, pageCount, segment);
     }
     this->hasZeroQueuedPages = false;
@@ -368,6 +368,9 @@ public:
     static uint const DefaultLowMaxFreePageCount = 0x100;    // 1 MB for low-memory process
 
     static uint const MinPartialDecommitFreePageCount = 0x1000;  // 16 MB
+#if ENABLE_BACKGROUND_PAGE_ZEROING && !defined(_WIN32)
+    static uint const MinDiscardZeroPageCount = 0x40;        // 256K: queued runs this large are zeroed by the OS instead of memset
+#endif
 
     static uint const DefaultMaxAllocPageCount = 32;        // 128K
     static uint const DefaultSecondaryAllocPageCount = 0;
@@ -468,6 +471,10 @@ public:
 #ifdef RECYCLER_MEMORY_VERIFY
     void EnableVerify() { verifyEnabled = true; }
 #endif
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    void EnableHugePageSegments();
+    bool HasHugePageSegments() const { return hugePageSegments; }
+#endif
 #if defined(RECYCLER_NO_PAGE_REUSE) || defined(ARENA_MEMORY_VERIFY)
     void ReenablePageReuse() { Assert(disablePageReuse); disablePageReuse = false; }
     bool DisablePageReuse() { bool wasDisablePageReuse = disablePageReuse; disablePageReuse = true; return wasDisablePageReuse; }
@@ -578,6 +585,10 @@ protected:
     bool stopAllocationOnOutOfMemory;
     bool disableAllocationOutOfMemory;
     bool excludeGuardPages;
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    // Page segments are carved out of huge pages (see EnableHugePageSegments)
+    bool hugePageSegments;
+#endif
     AllocationPolicyManager * policyManager;
     TVirtualAlloc * virtualAllocator;
 
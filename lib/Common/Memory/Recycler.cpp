@@ -3,7 +3,7 @@
 // Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
 //-------------------------------------------------------------------------------------------------------
 #include "CommonMemoryPch.h"
-#if ENABLE_CONCURRENT_GC
+#if ENABLE_CONCURRENT_GC && defined(_WIN32)
 #include <process.h>
 #endif
 
@@ -54,6 +54,8 @@ enum ETWEventGCActivationKind : unsigned
 
 DefaultRecyclerCollectionWrapper DefaultRecyclerCollectionWrapper::Instance;
 
+const uint Recycler::MaxParallelism;
+
 inline bool
 DefaultRecyclerCollectionWrapper::IsCollectionDisabled(Recycler * recycler)
 {
@@ -138,13 +140,8 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #endif
     threadPageAllocator(pageAllocator),
     markPagePool(configFlagsTable),
-    parallelMarkPagePool1(configFlagsTable),
-    parallelMarkPagePool2(configFlagsTable),
-    parallelMarkPagePool3(configFlagsTable),
     markContext(this, &this->markPagePool),
-    parallelMarkContext1(this, &this->parallelMarkPagePool1),
-    parallelMarkContext2(this, &this->parallelMarkPagePool2),
-    parallelMarkContext3(this, &this->parallelMarkPagePool3),
+    parallelMarkContextCount(0),
 #if ENABLE_PARTIAL_GC
     clientTrackedObjectAllocator(_u("CTO-List"), GetPageAllocator(), Js::Throw::OutOfMemory),
 #endif
@@ -163,17 +160,18 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     mainThreadHandle(NULL),
 #if ENABLE_CONCURRENT_GC
     backgroundFinishMarkCount(0),
+    collectionRescannedPageCount(0),
     hasPendingUnpinnedObject(false),
     hasPendingConcurrentFindRoot(false),
     queueTrackedObject(false),
     enableConcurrentMark(false),  // Default to non-concurrent
     enableParallelMark(false),
+    enableParallelSweep(false),
     enableConcurrentSweep(false),
+    inParallelSweepWeakReference(false),
     concurrentThread(NULL),
     concurrentWorkReadyEvent(NULL),
     concurrentWorkDoneEvent(NULL),
-    parallelThread1(this, &Recycler::ParallelWorkFunc<0>),
-    parallelThread2(this, &Recycler::ParallelWorkFunc<1>),
     priorityBoost(false),
     isAborting(false),
 #if DBG
@@ -263,9 +261,6 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #ifdef RECYCLER_MARK_TRACK
     this->markMap = NoCheckHeapNew(MarkMap, &NoCheckHeapAllocator::Instance, 163, &markMapCriticalSection);
     markContext.SetMarkMap(markMap);
-    parallelMarkContext1.SetMarkMap(markMap);
-    parallelMarkContext2.SetMarkMap(markMap);
-    parallelMarkContext3.SetMarkMap(markMap);
 #endif
 
 #ifdef RECYCLER_MEMORY_VERIFY
@@ -284,6 +279,18 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     }
 #endif
 
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    if (GetRecyclerFlagsTable().RecyclerHugePageSegments)
+    {
+        // Leave the thread page allocator alone; it is shared with the arenas
+        recyclerPageAllocator.EnableHugePageSegments();
+        recyclerLargeBlockPageAllocator.EnableHugePageSegments();
+#ifdef RECYCLER_WRITE_BARRIER_ALLOC_SEPARATE_PAGE
+        recyclerWithBarrierPageAllocator.EnableHugePageSegments();
+#endif
+    }
+#endif
+
     this->inDispose = false;
 
 #if DBG
@@ -322,19 +329,23 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #endif
 #endif
     ScheduleNextCollection();
+    RecyclerHeuristic::InitializeSettings(this->heuristicSettings, GetRecyclerFlagsTable());
+    this->adaptiveUncollectedAllocBytesCollection = this->heuristicSettings.minCollectionBytes;
+    this->tickCountLastResetHeuristicCounters = ::GetTickCount();
+    this->lastUncollectedAllocTickCount = 0;
 #if defined(RECYCLER_DUMP_OBJECT_GRAPH) ||  defined(LEAK_REPORT) || defined(CHECK_MEMORY_LEAK)
     this->inDllCanUnloadNow = false;
     this->inDetachProcess = false;
 #endif
 
     memset(&localTelemetryBlock, 0, sizeof(localTelemetryBlock));
+    memset(&gcStats, 0, sizeof(gcStats));
+    this->collectTrigger = RecyclerCollectTrigger_Explicit;
+    UpdateAdaptiveCollectionTrigger();
 
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     // recycler requires at least Recycler::PrimaryMarkStackReservedPageCount to function properly for the main mark context
     this->markContext.SetMaxPageCount(max(static_cast<size_t>(GetRecyclerFlagsTable().MaxMarkStackPageCount), static_cast<size_t>(Recycler::PrimaryMarkStackReservedPageCount)));
-    this->parallelMarkContext1.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
-    this->parallelMarkContext2.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
-    this->parallelMarkContext3.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
 
     if (GetRecyclerFlagsTable().IsEnabled(Js::GCMemoryThresholdFlag))
     {
@@ -470,6 +481,11 @@ Recycler::~Recycler()
 
     ClearObjectBeforeCollectCallbacks();
 
+#if ENABLE_CONCURRENT_GC
+    // Hosts expect every finalizer to have run by the time the runtime is gone
+    backgroundFinalizer.Shutdown();
+#endif
+
 #ifdef RECYCLER_DUMP_OBJECT_GRAPH
     if (GetRecyclerFlagsTable().DumpObjectGraphOnExit)
     {
@@ -516,9 +532,12 @@ Recycler::~Recycler()
 #endif
 
     markContext.Release();
-    parallelMarkContext1.Release();
-    parallelMarkContext2.Release();
-    parallelMarkContext3.Release();
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        this->parallelMarkContexts[i]->markContext.Release();
+        HeapDelete(this->parallelMarkContexts[i]);
+    }
+    this->parallelMarkContextCount = 0;
 
     // Clean up the weak reference map so that
     // objects being finalized can safely refer to weak references
@@ -728,6 +747,17 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
 #if ENABLE_CONCURRENT_GC
     this->skipStack = false;
 #endif
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+    this->enablePreciseStackFrames = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::PreciseStackFramesPhase);
+#else
+    this->enablePreciseStackFrames = true;
+#endif
+    this->enableDiscardFreeObjectPages = GetRecyclerFlagsTable().RecyclerDiscardFreeObjectPages;
+#ifdef RECYCLER_MEMORY_VERIFY
+    // Verify checks the fill pattern of free memory when it is reused
+    this->enableDiscardFreeObjectPages = this->enableDiscardFreeObjectPages && !this->verifyEnabled;
+#endif
+    this->enableBackgroundFinalize = GetRecyclerFlagsTable().RecyclerBackgroundFinalize;
 
 #if ENABLE_PARTIAL_GC
 #if ENABLE_DEBUG_CONFIG_OPTIONS
@@ -828,18 +858,34 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
 #endif
 #endif
 
+#if ENABLE_HUGE_PAGE_SEGMENTS && ENABLE_PARTIAL_GC
+    if (recyclerPageAllocator.HasHugePageSegments())
+    {
+        // Huge page segments aren't write watched, so each partial collection would rescan the whole heap
+        this->enablePartialCollect = false;
+    }
+#endif
+
     bool needWriteWatch = false;
 
 #if ENABLE_CONCURRENT_GC
     // Default to non-concurrent
     uint numProcs = (uint)AutoSystemInfo::Data.GetNumberOfPhysicalProcessors();
-    this->maxParallelism = (numProcs > 4) || CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase) ? 4 : numProcs;
+    uint configuredParallelism = min(RecyclerHeuristic::MaxParallelism(GetRecyclerFlagsTable()), MaxParallelism);
+    this->maxParallelism = (numProcs > configuredParallelism) || CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase) ? configuredParallelism : numProcs;
 
     if (forceInThread)
     {
         // Requested a non-concurrent recycler
         this->disableConcurrent = true;
     }
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    else if (recyclerPageAllocator.HasHugePageSegments())
+    {
+        // Huge page segments aren't write watched, so each concurrent rescan would cover the whole heap
+        this->disableConcurrent = true;
+    }
+#endif
 #if ENABLE_DEBUG_CONFIG_OPTIONS
     else if (CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ConcurrentCollectPhase))
     {
@@ -1258,7 +1304,7 @@ Recycler::LargeAlloc(HeapInfo* heap, size_t size, ObjectInfoBits attributes)
     if (addr == nullptr)
     {
         // Force a collection and try to allocate again.
-        this->CollectNow<CollectNowForceInThread>();
+        this->CollectNow<CollectOnAllocationFailure>();
         addr = TryLargeAlloc(heap, size, attributes, nothrow);
         if (addr == nullptr)
         {
@@ -1529,7 +1575,14 @@ Recycler::ScanStack()
     END_DUMP_OBJECT(this);
 
     BEGIN_DUMP_OBJECT(this, _u("Stack"));
-    ScanMemoryInline((void**) stackTop, stackScanned);
+    if (this->enablePreciseStackFrames)
+    {
+        ScanStackWithPreciseFrames((void**) stackTop, (void**) stackStart);
+    }
+    else
+    {
+        ScanMemoryInline((void**) stackTop, stackScanned);
+    }
     END_DUMP_OBJECT(this);
 
 #if DBG_DUMP
@@ -1548,6 +1601,40 @@ Recycler::ScanStack()
 
     return stackScanned;
 }
+
+void
+Recycler::ScanStackWithPreciseFrames(void ** stackTop, void ** stackStart)
+{
+    // The runtime reports the frames it knows the roots of from the leaf up, so at increasing addresses.
+    // Only the stack between them is scanned conservatively. Frames that aren't in the part of the stack
+    // left to scan (heap allocated frames, or any out of order) are skipped, and either scanned with the
+    // rest of the stack or kept alive by whatever holds them.
+    RecyclerScanMemoryCallback scanMemory(this);
+    char * scanStart = (char *)stackTop;
+    size_t frameBytes = 0;
+    void * frame = collectionWrapper->GetNextPreciseStackFrame(nullptr, &frameBytes);
+    while (frame != nullptr)
+    {
+        char * frameStart = (char *)frame;
+        if (frameStart >= scanStart && frameStart < (char *)stackStart && frameBytes <= (size_t)((char *)stackStart - frameStart))
+        {
+            Assert(((size_t)frameStart % sizeof(void *)) == 0);
+            ScanMemory((void **)scanStart, frameStart - scanStart);
+            size_t preciseBytes = collectionWrapper->ScanPreciseStackFrame(frame, scanMemory);
+            Assert(preciseBytes <= frameBytes);
+
+            RECYCLER_STATS_INC(this, preciseStackFrameCount);
+            RECYCLER_STATS_ADD(this, preciseStackFrameBytes, frameBytes);
+            RECYCLER_STATS_ADD(this, preciseStackSkippedBytes, frameBytes - preciseBytes);
+            this->gcStats.preciseStackFrameCount++;
+            this->gcStats.preciseStackFrameBytes += frameBytes;
+            this->gcStats.preciseStackSkippedBytes += frameBytes - preciseBytes;
+            scanStart = frameStart + frameBytes;
+        }
+        frame = collectionWrapper->GetNextPreciseStackFrame(frame, &frameBytes);
+    }
+    ScanMemory((void **)scanStart, (char *)stackStart - scanStart);
+}
 #pragma warning(pop)
 
 template <bool background>
@@ -1599,7 +1686,7 @@ size_t Recycler::ScanPinnedObjects()
 void
 RecyclerScanMemoryCallback::operator()(void** obj, size_t byteCount)
 {
-    this->recycler->ScanMemoryInline(obj, byteCount);
+    this->recycler->ScanMemory(obj, byteCount);
 }
 
 size_t
@@ -1840,6 +1927,9 @@ Recycler::ResetMarks(ResetMarkFlags flags)
     Assert(IsMarkStackEmpty());
     this->scanPinnedObjectMap = true;
     this->hasScannedInitialImplicitRoots = false;
+#if ENABLE_CONCURRENT_GC
+    this->collectionRescannedPageCount = 0;
+#endif
 
     heapBlockMap.ResetMarks();
 
@@ -2010,14 +2100,20 @@ Recycler::ProcessParallelMark(bool background, MarkContext * markContext)
 
     RECYCLER_PROFILE_EXEC_THREAD_BEGIN(background, this, Js::MarkPhase);
 
-    if (this->enableScanInteriorPointers)
-    {
-        this->ProcessMarkContext</* parallel */ true, /* interior */ true>(markContext);
-    }
-    else
+    // Once our own mark stack runs dry, keep taking work shared by the other contexts until they are all done.
+    this->parallelMarkWorkQueue.Join();
+    do
     {
-        this->ProcessMarkContext</* parallel */ true, /* interior */ false>(markContext);
+        if (this->enableScanInteriorPointers)
+        {
+            this->ProcessMarkContext</* parallel */ true, /* interior */ true>(markContext);
+        }
+        else
+        {
+            this->ProcessMarkContext</* parallel */ true, /* interior */ false>(markContext);
+        }
     }
+    while (this->parallelMarkWorkQueue.WaitForWork(markContext));
 
     RECYCLER_PROFILE_EXEC_THREAD_END(background, this, Js::MarkPhase);
 
@@ -2034,6 +2130,8 @@ Recycler::ProcessParallelMark(bool background, MarkContext * markContext)
 void
 Recycler::Mark()
 {
+    AutoRecyclerPauseTimer pauseTimer(&this->gcStats, RecyclerPausePhase_Mark);
+
     // Marking in thread, we can just pre-mark them
     ResetMarks(this->enableScanImplicitRoots ? ResetMarkFlags_InThreadImplicitRoots : ResetMarkFlags_InThread);
     collectionState = CollectionStateFindRoots;
@@ -2110,9 +2208,11 @@ Recycler::ResetMarkCollectionState()
 
     // If we aborted after doing a background parallel Mark, we wouldn't have cleaned up the
     // parallel markContexts yet. Clean these up now.
-    // Note parallelMarkContext1 is not used in background parallel (see DoBackgroundParallelMark)
-    parallelMarkContext2.Cleanup();
-    parallelMarkContext3.Cleanup();
+    // Note parallel mark context 0 is not used in background parallel (see DoBackgroundParallelMark)
+    for (uint i = 1; i < this->parallelMarkContextCount; i++)
+    {
+        this->parallelMarkContexts[i]->markContext.Cleanup();
+    }
 
     this->ClearNeedOOMRescan();
     DebugOnly(this->isProcessingRescan = false);
@@ -2134,12 +2234,50 @@ Recycler::ResetMarkCollectionState()
 void
 Recycler::ResetHeuristicCounters()
 {
+    uint currentTickCount = ::GetTickCount();
+    this->lastUncollectedAllocTickCount = currentTickCount - this->tickCountLastResetHeuristicCounters;
+    this->tickCountLastResetHeuristicCounters = currentTickCount;
+
     autoHeap.lastUncollectedAllocBytes = autoHeap.uncollectedAllocBytes;
     autoHeap.uncollectedAllocBytes = 0;
     autoHeap.uncollectedExternalBytes = 0;
     ResetPartialHeuristicCounters();
 }
 
+void
+Recycler::UpdateAdaptiveCollectionTrigger()
+{
+    if (!this->heuristicSettings.adaptive)
+    {
+        this->gcStats.nextCollectionBytes = RecyclerHeuristic::UncollectedAllocBytesCollection();
+        return;
+    }
+
+    size_t liveBytes = 0;
+    for (uint i = 0; i < RecyclerHeapKind_Count; i++)
+    {
+        liveBytes += this->gcStats.liveBytes[i];
+    }
+    uint64 pauseMicroseconds = 0;
+    for (uint i = 0; i < RecyclerPausePhase_Count; i++)
+    {
+        pauseMicroseconds += this->gcStats.lastPauseMicroseconds[i];
+    }
+
+    this->adaptiveUncollectedAllocBytesCollection = RecyclerHeuristic::AdaptiveUncollectedAllocBytesCollection(this->heuristicSettings,
+        liveBytes, autoHeap.lastUncollectedAllocBytes, this->lastUncollectedAllocTickCount, pauseMicroseconds);
+    this->gcStats.nextCollectionBytes = this->adaptiveUncollectedAllocBytesCollection;
+}
+
+void
+Recycler::SetHeuristicSettings(RecyclerHeuristicSettings const& settings)
+{
+    Assert(settings.minCollectionBytes <= settings.maxCollectionBytes);
+    this->heuristicSettings = settings;
+    this->adaptiveUncollectedAllocBytesCollection = settings.minCollectionBytes;
+    UpdateAdaptiveCollectionTrigger();
+}
+
 void Recycler::ResetPartialHeuristicCounters()
 {
 #if ENABLE_PARTIAL_GC
@@ -2231,6 +2369,7 @@ Recycler::RescanMark(DWORD waitTime)
 size_t
 Recycler::FinishMark(DWORD waitTime)
 {
+    AutoRecyclerPauseTimer pauseTimer(&this->gcStats, RecyclerPausePhase_Mark);
     size_t scannedRootBytes = RescanMark(waitTime);
     Assert(waitTime != INFINITE || scannedRootBytes != Recycler::InvalidScanRootBytes);
     if (scannedRootBytes != Recycler::InvalidScanRootBytes)
@@ -2270,14 +2409,18 @@ void
 Recycler::DoParallelMark()
 {
     Assert(this->enableParallelMark);
-    Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
+    Assert(this->maxParallelism > 1 && this->maxParallelism == this->parallelMarkContextCount + 1);
 
     // Split the mark stack into [this->maxParallelism] equal pieces.
     // The actual # of splits is returned, in case the stack was too small to split that many ways.
-    MarkContext * splitContexts[3] = { &parallelMarkContext1, &parallelMarkContext2, &parallelMarkContext3 };
-    uint actualSplitCount = markContext.Split(this->maxParallelism - 1, splitContexts);
+    MarkContext * splitContexts[MaxParallelism - 1];
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        splitContexts[i] = &this->parallelMarkContexts[i]->markContext;
+    }
+    uint actualSplitCount = markContext.Split(this->parallelMarkContextCount, splitContexts);
 
-    Assert(actualSplitCount <= 3);
+    Assert(actualSplitCount <= this->parallelMarkContextCount);
 
     // If we failed to split at all, just mark in thread with no parallelism.
     if (actualSplitCount == 0)
@@ -2300,19 +2443,19 @@ Recycler::DoParallelMark()
 
     // If there's enough work to split, then kick off marking on parallel threads too.
     // If the threads haven't been created yet, this will create them (or fail).
-    bool parallelSuccess1 = false;
-    bool parallelSuccess2 = false;
-    if (concurrentSuccess && actualSplitCount >= 2)
+    // Context 0 is ours and the concurrent thread has the main markContext, so parallel threads start at context 1.
+    uint parallelThreadCount = 0;
+    if (concurrentSuccess)
     {
-        parallelSuccess1 = parallelThread1.StartConcurrent();
-        if (parallelSuccess1 && actualSplitCount == 3)
+        while (parallelThreadCount + 1 < actualSplitCount
+            && this->parallelMarkContexts[parallelThreadCount + 1]->parallelThread.StartConcurrent())
         {
-            parallelSuccess2 = parallelThread2.StartConcurrent();
+            parallelThreadCount++;
         }
     }
 
     // Process our portion of the split.
-    this->ProcessParallelMark(false, &parallelMarkContext1);
+    this->ProcessParallelMark(false, &this->parallelMarkContexts[0]->markContext);
 
     // If we successfully launched parallel work, wait for it to complete.
     // If we failed, then process the work in-thread now.
@@ -2325,27 +2468,15 @@ Recycler::DoParallelMark()
         this->ProcessParallelMark(false, &markContext);
     }
 
-    if (actualSplitCount >= 2)
+    for (uint i = 1; i < actualSplitCount; i++)
     {
-        if (parallelSuccess1)
+        if (i <= parallelThreadCount)
         {
-            parallelThread1.WaitForConcurrent();
+            this->parallelMarkContexts[i]->parallelThread.WaitForConcurrent();
         }
         else
         {
-            this->ProcessParallelMark(false, &parallelMarkContext2);
-        }
-
-        if (actualSplitCount == 3)
-        {
-            if (parallelSuccess2)
-            {
-                parallelThread2.WaitForConcurrent();
-            }
-            else
-            {
-                this->ProcessParallelMark(false, &parallelMarkContext3);
-            }
+            this->ProcessParallelMark(false, &this->parallelMarkContexts[i]->markContext);
         }
     }
 
@@ -2374,19 +2505,23 @@ Recycler::DoBackgroundParallelMark()
 {
     // Split the mark stack into [this->maxParallelism - 1] equal pieces (thus, "- 2" below).
     // The actual # of splits is returned, in case the stack was too small to split that many ways.
-    // The parallel threads are hardwired to use parallelMarkContext2/3, so we split using those.
+    // Parallel thread i always uses parallel mark context i, so we split using contexts 1 and up.
     uint actualSplitCount = 0;
-    MarkContext * splitContexts[2] = { &parallelMarkContext2, &parallelMarkContext3 };
+    MarkContext * splitContexts[MaxParallelism - 2];
     if (this->enableParallelMark)
     {
-        Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
+        Assert(this->maxParallelism > 1 && this->maxParallelism == this->parallelMarkContextCount + 1);
         if (this->maxParallelism > 2)
         {
+            for (uint i = 1; i < this->parallelMarkContextCount; i++)
+            {
+                splitContexts[i - 1] = &this->parallelMarkContexts[i]->markContext;
+            }
             actualSplitCount = markContext.Split(this->maxParallelism - 2, splitContexts);
         }
     }
 
-    Assert(actualSplitCount <= 2);
+    Assert(actualSplitCount <= MaxParallelism - 2);
 
     // If we failed to split at all, just mark in thread with no parallelism.
     if (actualSplitCount == 0)
@@ -2406,12 +2541,11 @@ Recycler::DoBackgroundParallelMark()
 
     // Kick off marking on parallel threads too, if there is work for them
     // If the threads haven't been created yet, this will create them (or fail).
-    bool parallelSuccess1 = false;
-    bool parallelSuccess2 = false;
-    parallelSuccess1 = parallelThread1.StartConcurrent();
-    if (parallelSuccess1 && actualSplitCount == 2)
+    uint parallelThreadCount = 0;
+    while (parallelThreadCount < actualSplitCount
+        && this->parallelMarkContexts[parallelThreadCount + 1]->parallelThread.StartConcurrent())
     {
-        parallelSuccess2 = parallelThread2.StartConcurrent();
+        parallelThreadCount++;
     }
 
     // Process our portion of the split.
@@ -2419,24 +2553,15 @@ Recycler::DoBackgroundParallelMark()
 
     // If we successfully launched parallel work, wait for it to complete.
     // If we failed, then process the work in-thread now.
-    if (parallelSuccess1)
+    for (uint i = 1; i <= actualSplitCount; i++)
     {
-        parallelThread1.WaitForConcurrent();
-    }
-    else
-    {
-        this->ProcessParallelMark(true, &parallelMarkContext2);
-    }
-
-    if (actualSplitCount == 2)
-    {
-        if (parallelSuccess2)
+        if (i <= parallelThreadCount)
         {
-            parallelThread2.WaitForConcurrent();
+            this->parallelMarkContexts[i]->parallelThread.WaitForConcurrent();
         }
         else
         {
-            this->ProcessParallelMark(true, &parallelMarkContext3);
+            this->ProcessParallelMark(true, &this->parallelMarkContexts[i]->markContext);
         }
     }
 
@@ -2558,15 +2683,17 @@ Recycler::EndMark()
     // Clean up mark contexts, which will release held free pages
     // Do this for all contexts before we decommit, to make sure all pages are freed
     markContext.Cleanup();
-    parallelMarkContext1.Cleanup();
-    parallelMarkContext2.Cleanup();
-    parallelMarkContext3.Cleanup();
+    ForEachParallelMarkContext([](MarkContext * markContext)
+    {
+        markContext->Cleanup();
+    });
 
     // Decommit all pages
     markContext.DecommitPages();
-    parallelMarkContext1.DecommitPages();
-    parallelMarkContext2.DecommitPages();
-    parallelMarkContext3.DecommitPages();
+    ForEachParallelMarkContext([](MarkContext * markContext)
+    {
+        markContext->DecommitPages();
+    });
 
     GCETW(GC_DECOMMIT_CONCURRENT_COLLECT_PAGE_ALLOCATOR_STOP, (this));
 
@@ -2653,9 +2780,10 @@ Recycler::EndMarkOnLowMemory()
     while (this->NeedOOMRescan());
 
     Assert(!markContext.GetPageAllocator()->DisableAllocationOutOfMemory());
-    Assert(!parallelMarkContext1.GetPageAllocator()->DisableAllocationOutOfMemory());
-    Assert(!parallelMarkContext2.GetPageAllocator()->DisableAllocationOutOfMemory());
-    Assert(!parallelMarkContext3.GetPageAllocator()->DisableAllocationOutOfMemory());
+    ForEachParallelMarkContext([](MarkContext * markContext)
+    {
+        Assert(!markContext->GetPageAllocator()->DisableAllocationOutOfMemory());
+    });
     CUSTOM_PHASE_PRINT_TRACE1(GetRecyclerFlagsTable(), Js::RecyclerPhase, _u("EndMarkOnLowMemory iterations: %d\n"), iterations);
 
 #if ENABLE_PARTIAL_GC
@@ -2680,7 +2808,20 @@ Recycler::EndMarkOnLowMemory()
 bool
 Recycler::IsMarkStackEmpty()
 {
-    return (markContext.IsEmpty() && parallelMarkContext1.IsEmpty() && parallelMarkContext2.IsEmpty() && parallelMarkContext3.IsEmpty());
+    if (!markContext.IsEmpty())
+    {
+        return false;
+    }
+
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        if (!this->parallelMarkContexts[i]->markContext.IsEmpty())
+        {
+            return false;
+        }
+    }
+
+    return true;
 }
 #endif
 
@@ -2780,6 +2921,7 @@ Recycler::Sweep(bool concurrent)
     }
 
     RECYCLER_PROFILE_EXEC_BEGIN(this, concurrent? Js::ConcurrentSweepPhase : Js::SweepPhase);
+    AutoRecyclerPauseTimer pauseTimer(&this->gcStats, RecyclerPausePhase_Sweep);
 
 #if ENABLE_PARTIAL_GC
     recyclerSweepInstance.BeginSweep(this, rescanRootBytes, adjustPartialHeuristics);
@@ -2788,6 +2930,13 @@ Recycler::Sweep(bool concurrent)
 #endif
 
     this->SweepHeap(concurrent, *recyclerSweep);
+
+    // Every heap block has been looked at by now, even the ones that are left to the background to sweep
+    for (uint i = 0; i < RecyclerHeapKind_Count; i++)
+    {
+        this->gcStats.liveBytes[i] = recyclerSweep->GetLiveBytes((RecyclerHeapKind)i);
+    }
+    this->gcStats.sweptBytes = recyclerSweep->GetSweptBytes();
 #if ENABLE_CONCURRENT_GC
     if (concurrent)
     {
@@ -2864,37 +3013,51 @@ Recycler::SweepWeakReference()
     RECYCLER_PROFILE_EXEC_BEGIN(this, Js::SweepWeakPhase);
     GCETW(GC_SWEEP_WEAKREF_START, (this));
 
-    // REVIEW: Clean up the weak reference map concurrently?
-    bool hasCleanup = false;
-    weakReferenceMap.Map([&hasCleanup](RecyclerWeakReferenceBase * weakRef) -> bool
+    uint removedCount;
+#if ENABLE_CONCURRENT_GC
+    if (!this->DoParallelSweepWeakReference(&removedCount))
+#endif
     {
-        if (!weakRef->weakRefHeapBlock->TestObjectMarkedBit(weakRef))
-        {
-            hasCleanup = true;
+        removedCount = this->SweepWeakReferencePartitions(0, 1);
+    }
+    this->weakReferenceCleanupId += (removedCount != 0);
 
-            // Remove
-            return false;
-        }
+    GCETW(GC_SWEEP_WEAKREF_STOP, (this));
+    RECYCLER_PROFILE_EXEC_END(this, Js::SweepWeakPhase);
+}
 
-        if (!weakRef->strongRefHeapBlock->TestObjectMarkedBit(weakRef->strongRef))
+// Clean up every parallelCount-th partition of the weak reference map starting at parallelId.
+// Returns the number of entries removed.
+uint
+Recycler::SweepWeakReferencePartitions(uint parallelId, uint parallelCount)
+{
+    uint removedCount = 0;
+    for (uint i = parallelId; i < weakReferenceMap.PartitionCount; i += parallelCount)
+    {
+        removedCount += weakReferenceMap.MapPartition(i, [](RecyclerWeakReferenceBase * weakRef) -> bool
         {
-            hasCleanup = true;
-            weakRef->strongRef = nullptr;
+            if (!weakRef->weakRefHeapBlock->TestObjectMarkedBit(weakRef))
+            {
+                // Remove
+                return false;
+            }
 
-            // Put in a dummy heap block so that we can still do the isPendingConcurrentSweep check first.
-            weakRef->strongRefHeapBlock = &CollectedRecyclerWeakRefHeapBlock::Instance;
+            if (!weakRef->strongRefHeapBlock->TestObjectMarkedBit(weakRef->strongRef))
+            {
+                weakRef->strongRef = nullptr;
 
-            // Remove
-            return false;
-        }
+                // Put in a dummy heap block so that we can still do the isPendingConcurrentSweep check first.
+                weakRef->strongRefHeapBlock = &CollectedRecyclerWeakRefHeapBlock::Instance;
 
-        // Keep
-        return true;
-    });
-    this->weakReferenceCleanupId += hasCleanup;
+                // Remove
+                return false;
+            }
 
-    GCETW(GC_SWEEP_WEAKREF_STOP, (this));
-    RECYCLER_PROFILE_EXEC_END(this, Js::SweepWeakPhase);
+            // Keep
+            return true;
+        });
+    }
+    return removedCount;
 }
 
 void
@@ -2976,6 +3139,181 @@ Recycler::SweepHeap(bool concurrent, RecyclerSweep& recyclerSweep)
 #endif
 }
 
+#if ENABLE_CONCURRENT_GC
+// Sweep the non-finalizable small and medium buckets on the parallel mark threads.
+// Returns false if the caller should sweep them by itself.
+bool
+Recycler::DoParallelSweep(RecyclerSweep& recyclerSweep)
+{
+    uint parallelSweepCount = this->parallelMarkContextCount;
+    if (!this->enableParallelSweep || !this->enableParallelMark || parallelSweepCount < 2)
+    {
+        return false;
+    }
+
+#if ENABLE_PARTIAL_GC
+    // Partial collect queues blocks up for the reuse heuristics, which look at the whole heap.
+    if (this->inPartialCollectMode)
+    {
+        return false;
+    }
+#endif
+
+    // These report every swept object to something that expects a single sweeping thread.
+    if (this->ForceSweepObject() || RecyclerMemoryTracking::IsActive())
+    {
+        return false;
+    }
+#ifdef ENABLE_JS_ETW
+    if (EventEnabledJSCRIPT_RECYCLER_FREE_MEMORY())
+    {
+        return false;
+    }
+#endif
+
+    Assert(this->collectionState == CollectionStateSweep || this->collectionState == CollectionStateConcurrentSweep);
+
+    recyclerSweep.BeginParallelSweep(nullptr);
+    for (uint i = 1; i < parallelSweepCount; i++)
+    {
+        this->parallelMarkContexts[i]->recyclerSweep.BeginParallelSweep(&recyclerSweep);
+    }
+
+    // If the threads haven't been created yet, this will create them (or fail).
+    uint parallelThreadCount = 0;
+    while (parallelThreadCount + 1 < parallelSweepCount
+        && this->parallelMarkContexts[parallelThreadCount + 1]->parallelThread.StartConcurrent())
+    {
+        parallelThreadCount++;
+    }
+
+    // Sweep our share with the collection's RecyclerSweep
+    this->autoHeap.SweepSmallNonFinalizableBuckets(recyclerSweep, 0, parallelSweepCount);
+
+    // Wait for the threads we started and sweep the shares of the ones we couldn't start
+    for (uint i = 1; i < parallelSweepCount; i++)
+    {
+        RecyclerSweep& parallelSweep = this->parallelMarkContexts[i]->recyclerSweep;
+        if (i <= parallelThreadCount)
+        {
+            this->parallelMarkContexts[i]->parallelThread.WaitForConcurrent();
+        }
+        else
+        {
+            this->autoHeap.SweepSmallNonFinalizableBuckets(parallelSweep, i, parallelSweepCount);
+        }
+        parallelSweep.EndParallelSweep();
+    }
+
+    if (!recyclerSweep.IsBackground())
+    {
+        this->autoHeap.FreeParallelEmptyHeapBlocks(recyclerSweep);
+    }
+    recyclerSweep.EndParallelSweep();
+
+    if (parallelThreadCount != 0)
+    {
+        this->gcStats.parallelSweepCount++;
+    }
+    return true;
+}
+
+// Clean up the weak reference map partitions on the parallel mark threads.
+// Returns false if the caller should clean them up by itself.
+bool
+Recycler::DoParallelSweepWeakReference(uint * removedCount)
+{
+    // Only worth waking the threads up for when the map is big
+    static const uint MinParallelWeakReferenceCount = 16 * 1024;
+
+    uint parallelSweepCount = this->parallelMarkContextCount;
+    if (!this->enableParallelSweep || !this->enableParallelMark || parallelSweepCount < 2
+        || weakReferenceMap.Count() < MinParallelWeakReferenceCount)
+    {
+        return false;
+    }
+
+    Assert(!this->inParallelSweepWeakReference);
+    this->inParallelSweepWeakReference = true;
+
+    uint parallelThreadCount = 0;
+    while (parallelThreadCount + 1 < parallelSweepCount
+        && this->parallelMarkContexts[parallelThreadCount + 1]->parallelThread.StartConcurrent())
+    {
+        parallelThreadCount++;
+    }
+
+    uint totalRemovedCount = this->SweepWeakReferencePartitions(0, parallelSweepCount);
+
+    for (uint i = 1; i < parallelSweepCount; i++)
+    {
+        if (i <= parallelThreadCount)
+        {
+            this->parallelMarkContexts[i]->parallelThread.WaitForConcurrent();
+            totalRemovedCount += this->parallelMarkContexts[i]->weakReferenceRemovedCount;
+        }
+        else
+        {
+            totalRemovedCount += this->SweepWeakReferencePartitions(i, parallelSweepCount);
+        }
+    }
+
+    this->inParallelSweepWeakReference = false;
+    *removedCount = totalRemovedCount;
+
+    if (parallelThreadCount != 0)
+    {
+        this->gcStats.parallelWeakReferenceSweepCount++;
+    }
+    return true;
+}
+#endif
+
+// Freed medium leaf objects and objects on large block free lists keep their pages committed
+// until the whole block is free. Drop the physical pages that lie wholly inside such an object:
+// the first page keeps the free list link, and reuse either overwrites (leaf) or clears (large)
+// the rest. This may run on the concurrent and parallel sweep threads.
+void
+Recycler::DiscardFreeObjectPages(char * address, size_t size)
+{
+    Assert(this->enableDiscardFreeObjectPages);
+
+    char * discardAddress = (char *)::Math::Align<size_t>((size_t)address, AutoSystemInfo::PageSize);
+    char * discardEndAddress = (char *)((size_t)(address + size) & ~(size_t)(AutoSystemInfo::PageSize - 1));
+    if (discardEndAddress <= discardAddress)
+    {
+        return;
+    }
+
+    size_t discardSize = discardEndAddress - discardAddress;
+#ifdef _WIN32
+    if (::VirtualAlloc(discardAddress, discardSize, MEM_RESET, PAGE_READWRITE) == nullptr)
+#else
+    if (!PAL_VirtualZeroMemory(discardAddress, discardSize))
+#endif
+    {
+        return;
+    }
+
+    ::InterlockedExchangeAdd64((volatile LONG64 *)&this->gcStats.discardedBytes, (LONG64)discardSize);
+}
+
+void
+Recycler::FinalizeThreadAgnostic(ThreadAgnosticFinalizeFunc func, void * callback, void * data)
+{
+#if ENABLE_CONCURRENT_GC
+    // Without background work, or when the host brings its own thread service, finalize in thread
+    if (this->enableBackgroundFinalize && this->IsConcurrentEnabled()
+        && this->threadService != nullptr && !this->threadService->HasCallback()
+        && backgroundFinalizer.Queue(func, callback, data))
+    {
+        return;
+    }
+#endif
+    func(callback, data);
+}
+
+
 #if ENABLE_PARTIAL_GC && ENABLE_CONCURRENT_GC
 void
 Recycler::BackgroundFinishPartialCollect(RecyclerSweep * recyclerSweep)
@@ -3027,6 +3365,7 @@ Recycler::DisposeObjects()
     // Scope timestamp to just dispose
     {
         AUTO_TIMESTAMP(dispose);
+        AutoRecyclerPauseTimer pauseTimer(&this->gcStats, RecyclerPausePhase_Dispose);
         autoHeap.DisposeObjects();
     }
 
@@ -3207,6 +3546,7 @@ template BOOL Recycler::CollectNow<CollectNowForceInThread>();
 template BOOL Recycler::CollectNow<CollectNowForceInThreadExternal>();
 template BOOL Recycler::CollectNow<CollectNowForceInThreadExternalNoStack>();
 template BOOL Recycler::CollectNow<CollectOnRecoverFromOutOfMemory>();
+template BOOL Recycler::CollectNow<CollectOnAllocationFailure>();
 template BOOL Recycler::CollectNow<CollectNowDefault>();
 template BOOL Recycler::CollectNow<CollectOnSuspendCleanup>();
 template BOOL Recycler::CollectNow<CollectNowDefaultLSCleanup>();
@@ -3357,8 +3697,11 @@ Recycler::CollectWithHeuristic()
     }
 #endif
 
-    // allocation byte count heuristic, collect every 1 MB allocated
-    if (allocSize && (autoHeap.uncollectedAllocBytes < RecyclerHeuristic::UncollectedAllocBytesCollection()))
+    // allocation byte count heuristic, collect every 1 MB allocated, or with the adaptive heuristic once the
+    // size picked from the live heap and the allocation rate is allocated (see UpdateAdaptiveCollectionTrigger)
+    const size_t uncollectedAllocBytesCollection = this->heuristicSettings.adaptive ?
+        this->adaptiveUncollectedAllocBytesCollection : RecyclerHeuristic::UncollectedAllocBytesCollection();
+    if (allocSize && (autoHeap.uncollectedAllocBytes < uncollectedAllocBytesCollection))
     {
         return FinishDisposeObjectsWrapped<flags>();
     }
@@ -3416,6 +3759,8 @@ Recycler::Collect()
     // an exception. Use this flag to disable it the assertion if exception occur
     DebugOnly(this->hasIncompleteDoCollect = true);
 
+    this->collectTrigger = GetCollectTrigger<flags>();
+
     {
         RECORD_TIMESTAMP(initialCollectionStartTime);
         this->telemetryBlock->initialCollectionStartProcessUsedBytes = PageAllocator::GetProcessUsedBytes();
@@ -3425,6 +3770,25 @@ Recycler::Collect()
     }
 }
 
+template <CollectionFlags flags>
+RecyclerCollectTrigger
+Recycler::GetCollectTrigger()
+{
+    if (flags == CollectOnRecoverFromOutOfMemory || (flags & CollectOverride_AllocationFailure))
+    {
+        return RecyclerCollectTrigger_MemoryLimit;
+    }
+    if (flags == CollectOnScriptIdle)
+    {
+        return RecyclerCollectTrigger_Idle;
+    }
+    if (flags & CollectHeuristic_Mask)
+    {
+        return RecyclerCollectTrigger_Heuristic;
+    }
+    return RecyclerCollectTrigger_Explicit;
+}
+
 template <CollectionFlags flags>
 void Recycler::SetupPostCollectionFlags()
 {
@@ -3569,6 +3933,11 @@ Recycler::DoCollect(CollectionFlags flags)
 #if DBG
         collectionCount++;
 #endif
+        this->gcStats.collectionCount++;
+        this->gcStats.collectionCountByTrigger[this->collectTrigger]++;
+        this->gcStats.lastTrigger = this->collectTrigger;
+        memset(this->gcStats.lastPauseMicroseconds, 0, sizeof(this->gcStats.lastPauseMicroseconds));
+
         collectionState = Collection_PreCollection;
         collectionWrapper->PreCollectionCallBack(flags);
         collectionState = CollectionStateNotCollecting;
@@ -3955,6 +4324,7 @@ Recycler::BackgroundRescan(RescanFlags rescanFlags)
     size_t rescannedPageCount = heapBlockMap.Rescan(this, ((rescanFlags & RescanFlags_ResetWriteWatch) != 0));
 
     rescannedPageCount += autoHeap.Rescan(rescanFlags);
+    this->RecordRescan(rescannedPageCount, true);
 
     RECYCLER_PROFILE_EXEC_BACKGROUND_END(this, Js::BackgroundRescanPhase);
     GCETW(GC_BACKGROUNDRESCAN_STOP, (this, backgroundRescanCount));
@@ -3975,6 +4345,24 @@ Recycler::BackgroundRescan(RescanFlags rescanFlags)
     return Recycler::InvalidScanRootBytes;
 }
 
+void
+Recycler::RecordRescan(size_t pageCount, bool background)
+{
+    this->collectionRescannedPageCount += pageCount;
+    ::InterlockedExchangeAdd64((volatile LONG64 *)&this->gcStats.rescannedBytes, (LONG64)(pageCount * AutoSystemInfo::PageSize));
+
+#if ENABLE_PARTIAL_GC
+    bool const partial = this->inPartialCollectMode;
+#else
+    bool const partial = false;
+#endif
+    CUSTOM_PHASE_PRINT_TRACE1(GetRecyclerFlagsTable(), Js::RescanPhase,
+        _u("%s rescan: %llu pages (%llu bytes), %llu bytes so far this %s collection\n"),
+        background ? _u("Background") : _u("Foreground"),
+        (unsigned long long)pageCount, (unsigned long long)(pageCount * AutoSystemInfo::PageSize),
+        (unsigned long long)this->GetRescannedBytes(), partial ? _u("partial") : _u("full"));
+}
+
 void
 Recycler::BackgroundResetWriteWatchAll()
 {
@@ -4018,6 +4406,7 @@ Recycler::FinishMarkRescan(bool background)
     size_t scannedPageCount = heapBlockMap.Rescan(this, ((flags & RescanFlags_ResetWriteWatch) != 0));
 
     scannedPageCount += autoHeap.Rescan(flags);
+    this->RecordRescan(scannedPageCount, background);
 #else
     size_t scannedPageCount = 0;
 #endif
@@ -4058,9 +4447,10 @@ Recycler::ProcessTrackedObjects()
 
     // If we did a parallel mark, we need to process any queued tracked objects from the parallel mark stack as well.
     // If we didn't, this will do nothing.
-    parallelMarkContext1.ProcessTracked();
-    parallelMarkContext2.ProcessTracked();
-    parallelMarkContext3.ProcessTracked();
+    ForEachParallelMarkContext([](MarkContext * markContext)
+    {
+        markContext->ProcessTracked();
+    });
 
     DebugOnly(this->isProcessingTrackedObjects = false);
 
@@ -4114,37 +4504,42 @@ Recycler::CollectOnConcurrentThread()
         return false;
     }
 
-    const DWORD waitTime = RecyclerHeuristic::FinishConcurrentCollectWaitTime(this->GetRecyclerFlagsTable());
-    GCETW(GC_SYNCHRONOUSMARKWAIT_START, (this, waitTime));
-    const BOOL waited = WaitForConcurrentThread(waitTime);
-    GCETW(GC_SYNCHRONOUSMARKWAIT_STOP, (this, !waited));
-    if (!waited)
     {
-#ifdef RECYCLER_TRACE
-        if (GetRecyclerFlagsTable().Trace.IsEnabled(Js::RecyclerPhase)
-            || GetRecyclerFlagsTable().Trace.IsEnabled(Js::ThreadCollectPhase))
+        // Script is blocked while we wait for the background mark
+        AutoRecyclerPauseTimer pauseTimer(&this->gcStats, RecyclerPausePhase_Mark);
+
+        const DWORD waitTime = RecyclerHeuristic::FinishConcurrentCollectWaitTime(this->GetRecyclerFlagsTable());
+        GCETW(GC_SYNCHRONOUSMARKWAIT_START, (this, waitTime));
+        const BOOL waited = WaitForConcurrentThread(waitTime);
+        GCETW(GC_SYNCHRONOUSMARKWAIT_STOP, (this, !waited));
+        if (!waited)
         {
-            Output::Print(_u("%04X> RC(%p): %s: %s\n"), this->mainThreadId, this, Js::PhaseNames[Js::ThreadCollectPhase], _u("Timeout"));
-        }
+#ifdef RECYCLER_TRACE
+            if (GetRecyclerFlagsTable().Trace.IsEnabled(Js::RecyclerPhase)
+                || GetRecyclerFlagsTable().Trace.IsEnabled(Js::ThreadCollectPhase))
+            {
+                Output::Print(_u("%04X> RC(%p): %s: %s\n"), this->mainThreadId, this, Js::PhaseNames[Js::ThreadCollectPhase], _u("Timeout"));
+            }
 #endif
-        this->CollectionEnd<Js::ThreadCollectPhase>();
+            this->CollectionEnd<Js::ThreadCollectPhase>();
 
-        return false;
-    }
+            return false;
+        }
 
-    // If the concurrent thread was done within the time limit, there shouldn't be
-    // any object needs to be rescanned
-    // CONCURRENT-TODO: Optimize it so we don't rescan in the background if we are still waiting
-    // GC-TODO: Unfortunately we can't assert this, as the background code gen thread may still
-    // touch GC memory (e.g. FunctionBody), causing write watch and rescan
-    // in the background.
-    // Assert(markContext.Empty());
-    DebugOnly(this->isProcessingRescan = false);
+        // If the concurrent thread was done within the time limit, there shouldn't be
+        // any object needs to be rescanned
+        // CONCURRENT-TODO: Optimize it so we don't rescan in the background if we are still waiting
+        // GC-TODO: Unfortunately we can't assert this, as the background code gen thread may still
+        // touch GC memory (e.g. FunctionBody), causing write watch and rescan
+        // in the background.
+        // Assert(markContext.Empty());
+        DebugOnly(this->isProcessingRescan = false);
 
-    this->collectionState = CollectionStateMark;
-    this->ProcessTrackedObjects();
-    this->ProcessMark(false);
-    this->EndMark();
+        this->collectionState = CollectionStateMark;
+        this->ProcessTrackedObjects();
+        this->ProcessMark(false);
+        this->EndMark();
+    }
 
     // Partial collect mode is not re-enabled after a non-partial in-thread GC because partial GC heuristics are not adjusted
     // after a full in-thread GC. Enabling partial collect mode causes partial GC heuristics to be reset before the next full
@@ -4475,8 +4870,10 @@ Recycler::CleanupPendingUnroot()
     {
         pinnedObjectMap.MapAndRemoveIf([](void * obj, PinRecord const &refCount)
         {
+#ifdef STACK_BACK_TRACE
 #if defined(CHECK_MEMORY_LEAK) || defined(LEAK_REPORT)
             Assert(refCount != 0 || refCount.stackBackTraces == nullptr);
+#endif
 #endif
             return refCount == 0;
         });
@@ -4544,8 +4941,10 @@ Recycler::FinalizeConcurrent(bool restoreState)
 
     // Shutdown parallel threads and return the handle for them so the caller can
     // close it.
-    parallelThread1.Shutdown();
-    parallelThread2.Shutdown();
+    for (uint i = 1; i < this->parallelMarkContextCount; i++)
+    {
+        this->parallelMarkContexts[i]->parallelThread.Shutdown();
+    }
 
 #ifdef IDLE_DECOMMIT_ENABLED
     if (concurrentIdleDecommitEvent != nullptr)
@@ -4570,6 +4969,7 @@ Recycler::FinalizeConcurrent(bool restoreState)
         // Since we have shut down the concurrent thread, don't do a parallel mark.
         this->enableConcurrentMark = false;
         this->enableParallelMark = false;
+        this->enableParallelSweep = false;
         this->enableConcurrentSweep = false;
     }
 
@@ -4593,10 +4993,12 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
 #if ENABLE_DEBUG_CONFIG_OPTIONS
     this->enableConcurrentMark = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ConcurrentMarkPhase);
     this->enableParallelMark = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase);
+    this->enableParallelSweep = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ParallelSweepPhase);
     this->enableConcurrentSweep = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ConcurrentSweepPhase);
 #else
     this->enableConcurrentMark = true;
     this->enableParallelMark = true;
+    this->enableParallelSweep = true;
     this->enableConcurrentSweep = true;
 #endif
 
@@ -4606,6 +5008,11 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
         this->enableParallelMark = false;
     }
 
+    if (this->enableParallelMark && !this->InitializeParallelMarkContexts())
+    {
+        this->enableParallelMark = false;
+    }
+
     if (threadService->HasCallback())
     {
         this->threadService = threadService;
@@ -4614,32 +5021,19 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
     else
     {
         bool startConcurrentThread = true;
-        bool startedParallelThread1 = false;
-        bool startedParallelThread2 = false;
+        uint startedParallelThreadCount = 0;
 
-        if (startAllThreads)
+        if (startAllThreads && this->enableParallelMark)
         {
-            if (this->enableParallelMark && this->maxParallelism > 2)
+            // Parallel mark context 0 belongs to the main thread, so threads start at context 1
+            for (uint i = 1; i < this->parallelMarkContextCount; i++)
             {
-                if (!parallelThread1.EnableConcurrent(true))
+                if (!this->parallelMarkContexts[i]->parallelThread.EnableConcurrent(true))
                 {
                     startConcurrentThread = false;
+                    break;
                 }
-                else
-                {
-                    startedParallelThread1 = true;
-                    if (this->maxParallelism > 3)
-                    {
-                        if (!parallelThread2.EnableConcurrent(true))
-                        {
-                            startConcurrentThread = false;
-                        }
-                        else
-                        {
-                            startedParallelThread2 = true;
-                        }
-                    }
-                }
+                startedParallelThreadCount++;
             }
         }
 
@@ -4662,19 +5056,16 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
             }
         }
 
-        if (startedParallelThread1)
+        for (uint i = 1; i <= startedParallelThreadCount; i++)
         {
-            parallelThread1.Shutdown();
-            if (startedParallelThread2)
-            {
-                parallelThread2.Shutdown();
-            }
+            this->parallelMarkContexts[i]->parallelThread.Shutdown();
         }
     }
 
     // We failed to start a concurrent thread so we set these back to false and clean up
     this->enableConcurrentMark = false;
     this->enableParallelMark = false;
+    this->enableParallelSweep = false;
     this->enableConcurrentSweep = false;
 
     if (concurrentWorkReadyEvent)
@@ -4780,6 +5171,7 @@ BOOL
 Recycler::StartBackgroundMark(bool foregroundResetMark, bool foregroundFindRoots)
 {
     Assert(!this->CollectionInProgress());
+    AutoRecyclerPauseTimer pauseTimer(&this->gcStats, RecyclerPausePhase_Mark);
 
     CollectionState backgroundState = CollectionStateConcurrentResetMarks;
 
@@ -5387,6 +5779,7 @@ Recycler::FinishConcurrentCollect(CollectionFlags flags)
             gcTel.LogGCPauseStartTime();
         }
 #endif
+        AutoRecyclerPauseTimer pauseTimer(&this->gcStats, RecyclerPausePhase_Sweep);
         GCETW(GC_FLUSHZEROPAGE_START, (this));
 
         Assert(collectionState == CollectionStateTransferSweptWait);
@@ -5450,7 +5843,7 @@ Recycler::FinishConcurrentCollect(CollectionFlags flags)
 int
 Recycler::ExceptFilter(LPEXCEPTION_POINTERS pEP)
 {
-#if DBG
+#if DBG && defined(_WIN32)
     // Assert exception code
     if (pEP->ExceptionRecord->ExceptionCode == STATUS_ASSERTION_FAILURE)
     {
@@ -5482,19 +5875,23 @@ unsigned int
 Recycler::StaticThreadProc(LPVOID lpParameter)
 {
     DWORD ret = (DWORD)-1;
+#ifndef DISABLE_SEH
     __try
     {
+#endif
         Recycler * recycler = (Recycler *)lpParameter;
 
 #if DBG
         recycler->concurrentThreadExited = false;
 #endif
         ret = recycler->ThreadProc();
+#ifndef DISABLE_SEH
     }
     __except(Recycler::ExceptFilter(GetExceptionInformation()))
     {
         Assert(false);
     }
+#endif
 
     return ret;
 }
@@ -5647,7 +6044,7 @@ Recycler::ThreadProc()
 {
     Assert(this->IsConcurrentEnabled());
 
-#if !defined(_UCRT)
+#if defined(_WIN32) && !defined(_UCRT)
     // We do this before we set the concurrentWorkDoneEvent because GetModuleHandleEx requires
     // getting the loader lock. We could have the following case:
     //    Thread A => Initialize Concurrent Thread (C)
@@ -5763,7 +6160,7 @@ Recycler::ThreadProc()
     while (true);
     SetEvent(this->concurrentWorkDoneEvent);
 
-#if !defined(_UCRT)
+#if defined(_WIN32) && !defined(_UCRT)
     if (dllHandle)
     {
         FreeLibraryAndExitThread(dllHandle, 0);
@@ -5791,6 +6188,10 @@ Recycler::FinishCollection(bool needConcurrentSweep)
     }
     else
     {
+#if ENABLE_CONCURRENT_GC
+        // Finalizers only run in thread, so let the queued ones run alongside the background sweep
+        backgroundFinalizer.Flush();
+#endif
         FinishDisposeObjects();
     }
 }
@@ -5805,6 +6206,7 @@ Recycler::FinishCollection()
 
     // Reset the time heuristics
     ScheduleNextCollection();
+    UpdateAdaptiveCollectionTrigger();
 
     {
         AutoSwitchCollectionStates collectionState(this,
@@ -5838,6 +6240,11 @@ Recycler::FinishCollection()
     FlushFreeRecord();
 #endif
 
+#if ENABLE_CONCURRENT_GC
+    // Hand over everything queued during this collection, whichever path it took
+    backgroundFinalizer.Flush();
+#endif
+
     FinishDisposeObjects();
 
 #ifdef RECYCLER_FINALIZE_CHECK
@@ -6009,7 +6416,12 @@ Recycler::ShouldIdleCollectOnExit()
 
     Assert(!this->CollectionInProgress());
     // Idle GC use the size heuristic. Only need to schedule on if we passed it.
-    return (autoHeap.uncollectedAllocBytes >= RecyclerHeuristic::IdleUncollectedAllocBytesCollection);
+    size_t idleUncollectedAllocBytesCollection = RecyclerHeuristic::IdleUncollectedAllocBytesCollection;
+    if (this->heuristicSettings.adaptive)
+    {
+        idleUncollectedAllocBytesCollection = min(idleUncollectedAllocBytesCollection, this->adaptiveUncollectedAllocBytesCollection);
+    }
+    return (autoHeap.uncollectedAllocBytes >= idleUncollectedAllocBytesCollection);
 }
 
 #if ENABLE_CONCURRENT_GC
@@ -6108,13 +6520,47 @@ RecyclerParallelThread::EnableConcurrent(bool waitForThread)
 }
 
 
-template <uint parallelId>
+bool
+Recycler::InitializeParallelMarkContexts()
+{
+    Assert(this->maxParallelism > 1 && this->maxParallelism <= MaxParallelism);
+
+    // The contexts outlive a DisableConcurrent, so we only need to create them once.
+    while (this->parallelMarkContextCount < this->maxParallelism - 1)
+    {
+        ParallelMarkContext * parallelMarkContext = HeapNewNoThrow(ParallelMarkContext, this, this->parallelMarkContextCount, GetRecyclerFlagsTable());
+        if (parallelMarkContext == nullptr)
+        {
+            // Run with as much parallelism as we have contexts for
+            this->maxParallelism = this->parallelMarkContextCount + 1;
+            break;
+        }
+
+#ifdef RECYCLER_MARK_TRACK
+        parallelMarkContext->markContext.SetMarkMap(markMap);
+#endif
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+        parallelMarkContext->markContext.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
+#endif
+
+        this->parallelMarkContexts[this->parallelMarkContextCount++] = parallelMarkContext;
+    }
+
+    return this->parallelMarkContextCount != 0;
+}
+
 void
-Recycler::ParallelWorkFunc()
+Recycler::ParallelWorkFunc(uint parallelId)
 {
-    Assert(parallelId == 0 || parallelId == 1);
+    Assert(parallelId > 0 && parallelId < this->parallelMarkContextCount);
 
-    MarkContext * markContext = (parallelId == 0 ? &this->parallelMarkContext2 : &this->parallelMarkContext3);
+    MarkContext * markContext = &this->parallelMarkContexts[parallelId]->markContext;
+
+    if (this->inParallelSweepWeakReference)
+    {
+        this->parallelMarkContexts[parallelId]->weakReferenceRemovedCount = this->SweepWeakReferencePartitions(parallelId, this->parallelMarkContextCount);
+        return;
+    }
 
     switch (this->collectionState)
     {
@@ -6126,6 +6572,11 @@ Recycler::ParallelWorkFunc()
             this->ProcessParallelMark(true, markContext);
             break;
 
+        case CollectionStateSweep:
+        case CollectionStateConcurrentSweep:
+            this->autoHeap.SweepSmallNonFinalizableBuckets(this->parallelMarkContexts[parallelId]->recyclerSweep, parallelId, this->parallelMarkContextCount);
+            break;
+
         default:
             Assert(false);
     }
@@ -6188,15 +6639,17 @@ unsigned int
 RecyclerParallelThread::StaticThreadProc(LPVOID lpParameter)
 {
     DWORD ret = (DWORD)-1;
+#ifndef DISABLE_SEH
     __try
     {
+#endif
         RecyclerParallelThread * parallelThread = (RecyclerParallelThread *)lpParameter;
         Recycler * recycler = parallelThread->recycler;
         RecyclerParallelThread::WorkFunc workFunc = parallelThread->workFunc;
 
         Assert(recycler->IsConcurrentEnabled());
 
-#if !defined(_UCRT)
+#if defined(_WIN32) && !defined(_UCRT)
         HMODULE dllHandle = NULL;
         if (!GetModuleHandleEx(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS, (LPCTSTR)&RecyclerParallelThread::StaticThreadProc, &dllHandle))
         {
@@ -6230,7 +6683,7 @@ RecyclerParallelThread::StaticThreadProc(LPVOID lpParameter)
             }
 
             // Invoke the workFunc to do real work
-            (recycler->*workFunc)();
+            (recycler->*workFunc)(parallelThread->parallelId);
 
             // We always wait after the first time
             mustWait = true;
@@ -6242,18 +6695,20 @@ RecyclerParallelThread::StaticThreadProc(LPVOID lpParameter)
         // because the main thread may have torn it down already.
         SetEvent(parallelThread->concurrentWorkDoneEvent);
 
-#if !defined(_UCRT)
+#if defined(_WIN32) && !defined(_UCRT)
         if (dllHandle)
         {
             FreeLibraryAndExitThread(dllHandle, 0);
         }
 #endif
         ret = 0;
+#ifndef DISABLE_SEH
     }
     __except(Recycler::ExceptFilter(GetExceptionInformation()))
     {
         Assert(false);
     }
+#endif
 
     return ret;
 }
@@ -6267,10 +6722,194 @@ RecyclerParallelThread::StaticBackgroundWorkCallback(void * callbackData)
     Recycler * recycler = parallelThread->recycler;
     RecyclerParallelThread::WorkFunc workFunc = parallelThread->workFunc;
 
-    (recycler->*workFunc)();
+    (recycler->*workFunc)(parallelThread->parallelId);
 
     SetEvent(parallelThread->concurrentWorkDoneEvent);
 }
+
+RecyclerBackgroundFinalizer::RecyclerBackgroundFinalizer() :
+    queuedBatches(nullptr),
+    pendingBatches(nullptr),
+    workReadyEvent(NULL),
+    thread(NULL),
+    isShuttingDown(false)
+{
+}
+
+RecyclerBackgroundFinalizer::~RecyclerBackgroundFinalizer()
+{
+    Assert(queuedBatches == nullptr);
+    Assert(pendingBatches == nullptr);
+    Assert(thread == NULL);
+    Assert(workReadyEvent == NULL);
+}
+
+bool
+RecyclerBackgroundFinalizer::Queue(FinalizeFunc func, void * callback, void * data)
+{
+    if (this->isShuttingDown || !this->EnsureThread())
+    {
+        return false;
+    }
+
+    Batch * batch = this->queuedBatches;
+    if (batch == nullptr || batch->count == Batch::Capacity)
+    {
+        // Finalizers are called during sweep, so don't throw
+        batch = NoMemProtectHeapNewNoThrowStruct(Batch);
+        if (batch == nullptr)
+        {
+            return false;
+        }
+        batch->count = 0;
+        batch->next = this->queuedBatches;
+        this->queuedBatches = batch;
+    }
+
+    Entry& entry = batch->entries[batch->count++];
+    entry.func = func;
+    entry.callback = callback;
+    entry.data = data;
+    return true;
+}
+
+void
+RecyclerBackgroundFinalizer::Flush()
+{
+    Batch * batchList = this->queuedBatches;
+    if (batchList == nullptr)
+    {
+        return;
+    }
+    this->queuedBatches = nullptr;
+
+    Assert(this->thread != NULL);
+    {
+        AutoCriticalSection autoLock(&this->lock);
+        Batch * lastBatch = batchList;
+        while (lastBatch->next != nullptr)
+        {
+            lastBatch = lastBatch->next;
+        }
+        lastBatch->next = this->pendingBatches;
+        this->pendingBatches = batchList;
+    }
+    SetEvent(this->workReadyEvent);
+}
+
+void
+RecyclerBackgroundFinalizer::Shutdown()
+{
+    {
+        AutoCriticalSection autoLock(&this->lock);
+        this->isShuttingDown = true;
+    }
+
+    if (this->thread != NULL)
+    {
+        // The thread runs whatever is pending before it exits. If the OS killed it already
+        // (process shutdown), the wait returns anyway and we run the rest here.
+        SetEvent(this->workReadyEvent);
+        DWORD ret = WaitForSingleObject(this->thread, INFINITE);
+        AssertMsg(ret != WAIT_FAILED, "Check the handle passed to WaitForSingleObject.");
+
+        CloseHandle(this->thread);
+        this->thread = NULL;
+    }
+
+    if (this->workReadyEvent != NULL)
+    {
+        CloseHandle(this->workReadyEvent);
+        this->workReadyEvent = NULL;
+    }
+
+    Batch * batchList = this->pendingBatches;
+    this->pendingBatches = nullptr;
+    RunBatches(batchList);
+
+    batchList = this->queuedBatches;
+    this->queuedBatches = nullptr;
+    RunBatches(batchList);
+}
+
+bool
+RecyclerBackgroundFinalizer::EnsureThread()
+{
+    if (this->thread != NULL)
+    {
+        return true;
+    }
+
+    if (this->workReadyEvent == NULL)
+    {
+        this->workReadyEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+        if (this->workReadyEvent == NULL)
+        {
+            return false;
+        }
+    }
+
+    this->thread = (HANDLE)_beginthreadex(NULL, Recycler::ConcurrentThreadStackSize, &RecyclerBackgroundFinalizer::StaticThreadProc, this, STACK_SIZE_PARAM_IS_A_RESERVATION, NULL);
+    return this->thread != NULL;
+}
+
+// static
+void
+RecyclerBackgroundFinalizer::RunBatches(Batch * batchList)
+{
+    while (batchList != nullptr)
+    {
+        for (uint i = 0; i < batchList->count; i++)
+        {
+            Entry& entry = batchList->entries[i];
+            entry.func(entry.callback, entry.data);
+        }
+
+        Batch * next = batchList->next;
+        NoMemProtectHeapDelete(batchList);
+        batchList = next;
+    }
+}
+
+// static
+unsigned int
+RecyclerBackgroundFinalizer::StaticThreadProc(LPVOID lpParameter)
+{
+    RecyclerBackgroundFinalizer * backgroundFinalizer = (RecyclerBackgroundFinalizer *)lpParameter;
+
+#if defined(_WIN32) && !defined(_UCRT)
+    HMODULE dllHandle = NULL;
+    if (!GetModuleHandleEx(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS, (LPCTSTR)&RecyclerBackgroundFinalizer::StaticThreadProc, &dllHandle))
+    {
+        dllHandle = NULL;
+    }
+#endif
+
+    bool exit = false;
+    while (!exit)
+    {
+        DWORD result = WaitForSingleObject(backgroundFinalizer->workReadyEvent, INFINITE);
+        Assert(result == WAIT_OBJECT_0);
+
+        Batch * batchList;
+        {
+            AutoCriticalSection autoLock(&backgroundFinalizer->lock);
+            batchList = backgroundFinalizer->pendingBatches;
+            backgroundFinalizer->pendingBatches = nullptr;
+            exit = backgroundFinalizer->isShuttingDown;
+        }
+
+        RunBatches(batchList);
+    }
+
+#if defined(_WIN32) && !defined(_UCRT)
+    if (dllHandle)
+    {
+        FreeLibraryAndExitThread(dllHandle, 0);
+    }
+#endif
+    return 0;
+}
 #endif
 
 #ifdef RECYCLER_TRACE
@@ -6598,6 +7237,8 @@ Recycler::PrintMarkCollectionStats()
     Output::Print(_u("                                        | Non GC Int: %9d %5.1f | Stack   :%9d | NewFalse:%9d\n"),
         collectionStats.tryMarkInteriorNonRecyclerMemoryCount, (double)collectionStats.tryMarkInteriorNonRecyclerMemoryCount / (double)nonMark * 100,
         collectionStats.stackCount, collectionStats.markThruFalseNewObjCount);
+    Output::Print(_u("                                        | Precise Frames: %5d %10d | Not Scanned: %10d\n"),
+        collectionStats.preciseStackFrameCount, collectionStats.preciseStackFrameBytes, collectionStats.preciseStackSkippedBytes);
 }
 
 void
@@ -8190,13 +8831,14 @@ Recycler::NotifyFree(__in char *address, size_t size)
 #endif
 
 #ifdef RECYCLER_STATS
-    collectionStats.objectSweptCount++;
-    collectionStats.objectSweptBytes += size;
+    // Objects can be swept on the parallel threads
+    RECYCLER_STATS_INTERLOCKED_INC(this, objectSweptCount);
+    RECYCLER_STATS_INTERLOCKED_ADD(this, objectSweptBytes, size);
 
     if (!isForceSweeping)
     {
-        collectionStats.objectSweptFreeListCount++;
-        collectionStats.objectSweptFreeListBytes += size;
+        RECYCLER_STATS_INTERLOCKED_INC(this, objectSweptFreeListCount);
+        RECYCLER_STATS_INTERLOCKED_ADD(this, objectSweptFreeListBytes, size);
     }
 #endif
 }
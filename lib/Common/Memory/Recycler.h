@@ -252,6 +252,7 @@ enum CollectionFlags
     CollectOverride_FinishConcurrentTimeout = 0x00200000,
     CollectOverride_NoExhaustiveCollect = 0x00400000,
     CollectOverride_SkipStack           = 0x01000000,
+    CollectOverride_AllocationFailure   = 0x02000000,   // Only tells RecyclerGCStats why we collected
 
     CollectMode_Partial                 = 0x08000000,
     CollectMode_Concurrent              = 0x10000000,
@@ -277,6 +278,7 @@ enum CollectionFlags
     CollectExhaustiveCandidate      = CollectHeuristic_Never | CollectOverride_ExhaustiveCandidate,
     CollectOnScriptCloseNonPrimary  = CollectNowConcurrent | CollectOverride_ExhaustiveCandidate | CollectOverride_AllowDispose,
     CollectOnRecoverFromOutOfMemory = CollectOverride_ForceInThread | CollectMode_DecommitNow,
+    CollectOnAllocationFailure      = CollectNowForceInThread | CollectOverride_AllocationFailure,
     CollectOnSuspendCleanup         = CollectNowConcurrent | CollectMode_Exhaustive | CollectMode_DecommitNow | CollectOverride_DisableIdleFinish,
 
     FinishConcurrentOnIdle          = CollectMode_Concurrent | CollectOverride_DisableIdleFinish,
@@ -318,6 +320,10 @@ public:
     virtual void PreSweepCallback() = 0;
     virtual void PreRescanMarkCallback() = 0;
     virtual size_t RootMarkCallback(RecyclerScanMemoryCallback& scanMemoryCallback, BOOL * stacksScannedByRuntime) = 0;
+    // Frames on the script thread's stack whose roots the runtime knows, from the leaf up (nullptr starts at the leaf).
+    // The stack scan skips the frameBytes from the frame's address and has ScanPreciseStackFrame scan it instead.
+    virtual void * GetNextPreciseStackFrame(void * frame, size_t * frameBytes) = 0;
+    virtual size_t ScanPreciseStackFrame(void * frame, RecyclerScanMemoryCallback& scanMemoryCallback) = 0;
     virtual void RescanMarkTimeoutCallback() = 0;
     virtual void EndMarkCallback() = 0;
     virtual void ConcurrentCallback() = 0;
@@ -348,6 +354,8 @@ public:
     virtual void RescanMarkTimeoutCallback() override {}
     virtual void EndMarkCallback() override {}
     virtual size_t RootMarkCallback(RecyclerScanMemoryCallback& scanMemoryCallback, BOOL * stacksScannedByRuntime) override { *stacksScannedByRuntime = FALSE; return 0; }
+    virtual void * GetNextPreciseStackFrame(void * frame, size_t * frameBytes) override { return nullptr; }
+    virtual size_t ScanPreciseStackFrame(void * frame, RecyclerScanMemoryCallback& scanMemoryCallback) override { return 0; }
     virtual void ConcurrentCallback() override {}
     virtual void WaitCollectionCallBack() override {}
     virtual void PostCollectionCallBack() override {}
@@ -404,6 +412,9 @@ struct RecyclerCollectionStats
     size_t tryMarkInteriorNonRecyclerMemoryCount;
     size_t rootCount;
     size_t stackCount;
+    size_t preciseStackFrameCount;      // Frames the runtime scanned precisely instead of the stack scan
+    size_t preciseStackFrameBytes;
+    size_t preciseStackSkippedBytes;    // Bytes of those frames that weren't scanned at all
     size_t remarkCount;
 
     size_t scanCount;           // non-leaf objects marked.
@@ -544,11 +555,12 @@ struct CollectionParam
 class RecyclerParallelThread
 {
 public:
-    typedef void (Recycler::* WorkFunc)();
+    typedef void (Recycler::* WorkFunc)(uint parallelId);
 
-    RecyclerParallelThread(Recycler * recycler, WorkFunc workFunc) :
+    RecyclerParallelThread(Recycler * recycler, WorkFunc workFunc, uint parallelId) :
         recycler(recycler),
         workFunc(workFunc),
+        parallelId(parallelId),
         concurrentWorkReadyEvent(NULL),
         concurrentWorkDoneEvent(NULL),
         concurrentThread(NULL)
@@ -577,11 +589,59 @@ private:
 private:
     WorkFunc workFunc;
     Recycler * recycler;
+    uint parallelId;
     HANDLE concurrentWorkReadyEvent;// main thread uses this event to tell concurrent threads that the work is ready
     HANDLE concurrentWorkDoneEvent;// concurrent threads use this event to tell main thread that the work allocated is done
     HANDLE concurrentThread;
     bool synchronizeOnStartup;
 };
+
+// Runs finalizers that don't touch script thread state off the script thread.
+// The sweep queues them up; at the end of the collection the batch goes to a thread of our own,
+// created the first time there is something to run.
+class RecyclerBackgroundFinalizer
+{
+public:
+    typedef void (*FinalizeFunc)(void * callback, void * data);
+
+    RecyclerBackgroundFinalizer();
+    ~RecyclerBackgroundFinalizer();
+
+    // Called by the sweeping thread. Returns false if the caller has to finalize the object itself.
+    bool Queue(FinalizeFunc func, void * callback, void * data);
+    // Called on the script thread at the end of the collection, to hand the queued finalizers to the thread
+    void Flush();
+    // Runs everything that is still queued, and stops the thread
+    void Shutdown();
+
+private:
+    struct Entry
+    {
+        FinalizeFunc func;
+        void * callback;
+        void * data;
+    };
+
+    struct Batch
+    {
+        static const uint Capacity = 256;
+
+        Batch * next;
+        uint count;
+        Entry entries[Capacity];
+    };
+
+    bool EnsureThread();
+    static void RunBatches(Batch * batchList);
+    static unsigned int StaticThreadProc(LPVOID lpParameter);
+
+    Batch * queuedBatches;          // Filled by the current sweep, only touched by the sweeping thread
+    Batch * pendingBatches;         // Handed to the thread, under the lock
+    CriticalSection lock;
+    HANDLE workReadyEvent;
+    HANDLE thread;
+    bool isShuttingDown;
+};
 #endif
 
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
@@ -608,6 +668,7 @@ class Recycler
     friend class HeapBlockMap32;
 #if ENABLE_CONCURRENT_GC
     friend class RecyclerParallelThread;
+    friend class RecyclerBackgroundFinalizer;
 #endif
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     friend class AutoProtectPages;
@@ -729,7 +790,7 @@ private:
     typedef SimpleHashTable<void *, PinRecord, HeapAllocator, DefaultComparer, true, PrimePolicy> PinnedObjectHashTable;
     PinnedObjectHashTable pinnedObjectMap;
 
-    WeakReferenceHashTable<PrimePolicy> weakReferenceMap;
+    PartitionedWeakReferenceHashTable<PrimePolicy> weakReferenceMap;
     uint weakReferenceCleanupId;
 
     void * transientPinnedObject;
@@ -786,21 +847,72 @@ private:
 
     MarkContext markContext;
 
-    // Contexts for parallel marking.
-    // We support up to 4 way parallelism, main context + 3 additional parallel contexts.
-    MarkContext parallelMarkContext1;
-    MarkContext parallelMarkContext2;
-    MarkContext parallelMarkContext3;
-
-    // Page pools for above markContexts
+    // Page pool for above markContext
     PagePool markPagePool;
-    PagePool parallelMarkPagePool1;
-    PagePool parallelMarkPagePool2;
-    PagePool parallelMarkPagePool3;
+
+    // Contexts for parallel marking, each with the page pool for its mark stack.
+    // The main context is joined by up to MaxParallelism - 1 of these, allocated when parallel mark is enabled.
+    // Context 0 is processed by the thread doing DoParallelMark; each of the others has its own parallel thread.
+    // DoParallelSweep reuses the same threads, with the sweeping thread standing in for context 0.
+    class ParallelMarkContext
+    {
+    public:
+        ParallelMarkContext(Recycler * recycler, uint parallelId, Js::ConfigFlagsTable& flagsTable) :
+            pagePool(flagsTable),
+            markContext(recycler, &pagePool)
+#if ENABLE_CONCURRENT_GC
+            , parallelThread(recycler, &Recycler::ParallelWorkFunc, parallelId)
+            , weakReferenceRemovedCount(0)
+#endif
+        {
+        }
+
+        PagePool pagePool;
+        MarkContext markContext;
+#if ENABLE_CONCURRENT_GC
+        RecyclerParallelThread parallelThread;
+        RecyclerSweep recyclerSweep;
+        uint weakReferenceRemovedCount;
+#endif
+    };
+
+    static const uint MaxParallelism = PageStack<void *>::MaxSplitTargets + 1;
+
+    ParallelMarkContext * parallelMarkContexts[MaxParallelism - 1];
+    uint parallelMarkContextCount;
+
+    template <typename Fn>
+    void ForEachParallelMarkContext(Fn fn)
+    {
+        for (uint i = 0; i < this->parallelMarkContextCount; i++)
+        {
+            fn(&this->parallelMarkContexts[i]->markContext);
+        }
+    }
 
     bool IsMarkStackEmpty();
-    bool HasPendingMarkObjects() const { return markContext.HasPendingMarkObjects() || parallelMarkContext1.HasPendingMarkObjects() || parallelMarkContext2.HasPendingMarkObjects() || parallelMarkContext3.HasPendingMarkObjects(); }
-    bool HasPendingTrackObjects() const { return markContext.HasPendingTrackObjects() || parallelMarkContext1.HasPendingTrackObjects() || parallelMarkContext2.HasPendingTrackObjects() || parallelMarkContext3.HasPendingTrackObjects(); }
+    bool HasPendingMarkObjects() const
+    {
+        for (uint i = 0; i < this->parallelMarkContextCount; i++)
+        {
+            if (this->parallelMarkContexts[i]->markContext.HasPendingMarkObjects())
+            {
+                return true;
+            }
+        }
+        return markContext.HasPendingMarkObjects();
+    }
+    bool HasPendingTrackObjects() const
+    {
+        for (uint i = 0; i < this->parallelMarkContextCount; i++)
+        {
+            if (this->parallelMarkContexts[i]->markContext.HasPendingTrackObjects())
+            {
+                return true;
+            }
+        }
+        return markContext.HasPendingTrackObjects();
+    }
 
     RecyclerCollectionWrapper * collectionWrapper;
     HANDLE mainThreadHandle;
@@ -875,6 +987,12 @@ private:
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     bool disableCollection;
 #endif
+    bool enablePreciseStackFrames;
+    bool enableDiscardFreeObjectPages;
+    bool enableBackgroundFinalize;
+#if ENABLE_CONCURRENT_GC
+    RecyclerBackgroundFinalizer backgroundFinalizer;
+#endif
 
 #if ENABLE_PARTIAL_GC
     bool enablePartialCollect;
@@ -912,23 +1030,25 @@ private:
     bool disableConcurrent;
     bool enableConcurrentMark;
     bool enableParallelMark;
+    bool enableParallelSweep;
     bool enableConcurrentSweep;
+    bool inParallelSweepWeakReference;      // The parallel threads are cleaning up weak reference map partitions
 
     uint maxParallelism;        // Max # of total threads to run in parallel
 
+    ParallelMarkWorkQueue parallelMarkWorkQueue;
+
     byte backgroundRescanCount;             // for ETW events and stats
     byte backgroundFinishMarkCount;
     size_t backgroundRescanRootBytes;
+    size_t collectionRescannedPageCount;    // pages rescanned because of write watch during the current collection
     HANDLE concurrentWorkReadyEvent; // main thread uses this event to tell concurrent threads that the work is ready
     HANDLE concurrentWorkDoneEvent; // concurrent threads use this event to tell main thread that the work allocated is done
     HANDLE concurrentThread;
 
 
-    template <uint parallelId>
-    void ParallelWorkFunc();
-
-    RecyclerParallelThread parallelThread1;
-    RecyclerParallelThread parallelThread2;
+    void ParallelWorkFunc(uint parallelId);
+    bool InitializeParallelMarkContexts();
 
 #if DBG
     // Variable indicating if the concurrent thread has exited or not
@@ -963,7 +1083,7 @@ private:
 
 #ifdef IDLE_DECOMMIT_ENABLED
     HANDLE concurrentIdleDecommitEvent;
-    DWORD needIdleDecommitSignal;
+    LONG needIdleDecommitSignal;
 #endif
 
 #if ENABLE_PARTIAL_GC
@@ -979,6 +1099,11 @@ private:
     uint tickCountNextCollection;
     uint tickCountNextFinishCollection;
 
+    RecyclerHeuristicSettings heuristicSettings;
+    size_t adaptiveUncollectedAllocBytesCollection;     // Only used with heuristicSettings.adaptive
+    uint tickCountLastResetHeuristicCounters;
+    uint lastUncollectedAllocTickCount;                 // How long it took to allocate autoHeap.lastUncollectedAllocBytes
+
     void (*outOfMemoryFunc)();
 #ifdef RECYCLER_TEST_SUPPORT
     BOOL (*checkFn)(char* addr, size_t size);
@@ -1013,6 +1138,8 @@ private:
 #endif
     RecyclerWatsonTelemetryBlock localTelemetryBlock;
     RecyclerWatsonTelemetryBlock * telemetryBlock;
+    RecyclerGCStats gcStats;
+    RecyclerCollectTrigger collectTrigger;
 
 #ifdef RECYCLER_STATS
     RecyclerCollectionStats collectionStats;
@@ -1075,6 +1202,16 @@ public:
 
     char* Realloc(void* buffer, size_t existingBytes, size_t requestedBytes, bool truncate = true);
     void SetTelemetryBlock(RecyclerWatsonTelemetryBlock * telemetryBlock) { this->telemetryBlock = telemetryBlock; }
+    void GetGCStats(RecyclerGCStats * stats) const { *stats = this->gcStats; }
+
+    // Hand the physical pages lying wholly inside a freed object back to the OS (-RecyclerDiscardFreeObjectPages)
+    bool IsDiscardFreeObjectPagesEnabled() const { return this->enableDiscardFreeObjectPages; }
+    void DiscardFreeObjectPages(char * address, size_t size);
+
+    // For finalizers that don't touch script thread state: runs func(callback, data) later on a background thread
+    // (-RecyclerBackgroundFinalize), or right away when there is none. Only valid from FinalizableObject::Finalize.
+    typedef void (*ThreadAgnosticFinalizeFunc)(void * callback, void * data);
+    void FinalizeThreadAgnostic(ThreadAgnosticFinalizeFunc func, void * callback, void * data);
 
     void Prime();
 
@@ -1095,9 +1232,10 @@ public:
     {
         this->needOOMRescan = false;
         markContext.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
-        parallelMarkContext1.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
-        parallelMarkContext2.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
-        parallelMarkContext3.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
+        ForEachParallelMarkContext([](MarkContext * markContext)
+        {
+            markContext->GetPageAllocator()->ResetDisableAllocationOutOfMemory();
+        });
     }
 
     BOOL RequestConcurrentWrapperCallback();
@@ -1142,6 +1280,8 @@ public:
 
     bool ShouldIdleCollectOnExit();
     void ScheduleNextCollection();
+    void SetHeuristicSettings(RecyclerHeuristicSettings const& settings);
+    void GetHeuristicSettings(RecyclerHeuristicSettings * settings) const { *settings = this->heuristicSettings; }
 
     IdleDecommitPageAllocator * GetRecyclerLeafPageAllocator()
     {
@@ -1185,6 +1325,8 @@ public:
 
     template <CollectionFlags flags>
     void SetupPostCollectionFlags();
+    template <CollectionFlags flags>
+    static RecyclerCollectTrigger GetCollectTrigger();
     void EnsureNotCollecting();
 
 #if ENABLE_CONCURRENT_GC
@@ -1574,6 +1716,7 @@ private:
     template <bool background>
     size_t ScanPinnedObjects();
     size_t ScanStack();
+    void ScanStackWithPreciseFrames(void ** stackTop, void ** stackStart);
     size_t ScanArena(ArenaData * alloc, bool background);
     void ScanImplicitRoots();
     void ScanInitialImplicitRoots();
@@ -1605,6 +1748,10 @@ private:
 
 public:
     bool IsObjectMarked(void* candidate) { return this->heapBlockMap.IsMarked(candidate); }
+#if ENABLE_CONCURRENT_GC
+    // Bytes of dirty (write watched) pages rescanned by the current, or last completed, collection
+    size_t GetRescannedBytes() const { return this->collectionRescannedPageCount * AutoSystemInfo::PageSize; }
+#endif
 #ifdef RECYCLER_STRESS
     bool StressCollectNow();
 #endif
@@ -1636,8 +1783,13 @@ private:
     bool Sweep(bool concurrent = false);
 #endif
     void SweepWeakReference();
+    uint SweepWeakReferencePartitions(uint parallelId, uint parallelCount);
     void SweepHeap(bool concurrent, RecyclerSweep& recyclerSweep);
     void FinishSweep(RecyclerSweep& recyclerSweep);
+#if ENABLE_CONCURRENT_GC
+    bool DoParallelSweep(RecyclerSweep& recyclerSweep);
+    bool DoParallelSweepWeakReference(uint * removedCount);
+#endif
 
     bool FinishDisposeObjects();
     template <CollectionFlags flags>
@@ -1651,6 +1803,7 @@ private:
     void ResetCollectionState();
     void ResetMarkCollectionState();
     void ResetHeuristicCounters();
+    void UpdateAdaptiveCollectionTrigger();
     void ResetPartialHeuristicCounters();
     BOOL IsMarkState() const;
     BOOL IsFindRootsState() const;
@@ -1729,6 +1882,7 @@ private:
     size_t BackgroundScanStack();
     size_t BackgroundRepeatMark();
     size_t BackgroundRescan(RescanFlags rescanFlags);
+    void RecordRescan(size_t pageCount, bool background);
     void BackgroundResetWriteWatchAll();
     size_t BackgroundFinishMark();
 
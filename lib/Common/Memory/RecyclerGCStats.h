@@ -0,0 +1,126 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Memory
+{
+    // Collection statistics that are always collected (unlike RECYCLER_STATS), so that a host can
+    // read them in production through JsGetRuntimeGCStats. The enums match the JSRT ones.
+
+    enum RecyclerCollectTrigger
+    {
+        RecyclerCollectTrigger_Heuristic,       // Allocation volume or time since the last collection
+        RecyclerCollectTrigger_MemoryLimit,     // Recovering from a failed allocation
+        RecyclerCollectTrigger_Idle,            // Script went idle
+        RecyclerCollectTrigger_Explicit,        // Host or script asked for it, or a context is closing
+
+        RecyclerCollectTrigger_Count
+    };
+
+    // Parts of a collection during which script can't run
+    enum RecyclerPausePhase
+    {
+        RecyclerPausePhase_Mark,                // In-thread mark, and rescan at the end of a concurrent mark
+        RecyclerPausePhase_Sweep,
+        RecyclerPausePhase_Dispose,
+
+        RecyclerPausePhase_Count
+    };
+
+    enum RecyclerHeapKind
+    {
+        RecyclerHeapKind_Normal,                // Small and medium, with or without write barrier
+        RecyclerHeapKind_Leaf,
+        RecyclerHeapKind_Finalizable,
+        RecyclerHeapKind_Large,
+
+        RecyclerHeapKind_Count
+    };
+
+    struct RecyclerGCStats
+    {
+        uint collectionCount;
+        uint collectionCountByTrigger[RecyclerCollectTrigger_Count];
+        RecyclerCollectTrigger lastTrigger;
+
+        // Pauses of the last collection, and of all collections
+        uint64 lastPauseMicroseconds[RecyclerPausePhase_Count];
+        uint64 totalPauseMicroseconds[RecyclerPausePhase_Count];
+        uint64 maxPauseMicroseconds;
+
+        // Bytes found live and bytes freed by the last sweep
+        size_t liveBytes[RecyclerHeapKind_Count];
+        size_t sweptBytes;
+
+        // Bytes of physical memory under freed objects handed back to the OS, over all collections
+        uint64 discardedBytes;
+
+        // Bytes of dirty (write watched) pages rescanned at the end of concurrent or partial marks,
+        // over all collections
+        uint64 rescannedBytes;
+
+        // Collections that shared the sweep of the small and medium non-finalizable buckets with
+        // the parallel threads
+        uint parallelSweepCount;
+
+        // Collections that cleaned up the weak reference map partitions on the parallel threads
+        uint parallelWeakReferenceSweepCount;
+
+        // Interpreter frames the in-thread stack scans scanned precisely, their bytes, and the bytes of
+        // them that weren't scanned at all, over all collections
+        uint64 preciseStackFrameCount;
+        uint64 preciseStackFrameBytes;
+        uint64 preciseStackSkippedBytes;
+
+        // Bytes to allocate before the allocation heuristic considers the next collection
+        size_t nextCollectionBytes;
+
+        // Number of AutoRecyclerPauseTimer scopes open; only the outermost one is timed
+        uint pauseTimerDepth;
+    };
+
+    // Adds the time spent in scope to the phase's pause. Pause scopes can nest (for instance a mark
+    // started from within another pause); the inner ones are not timed, so no time is counted twice.
+    class AutoRecyclerPauseTimer
+    {
+    public:
+        AutoRecyclerPauseTimer(RecyclerGCStats * stats, RecyclerPausePhase phase) :
+            stats(stats), phase(phase), isOutermost(stats->pauseTimerDepth == 0)
+        {
+            stats->pauseTimerDepth++;
+            if (isOutermost)
+            {
+                ::QueryPerformanceCounter(&start);
+            }
+        }
+        ~AutoRecyclerPauseTimer()
+        {
+            Assert(stats->pauseTimerDepth != 0);
+            stats->pauseTimerDepth--;
+            if (!isOutermost)
+            {
+                return;
+            }
+
+            LARGE_INTEGER end;
+            LARGE_INTEGER frequency;
+            ::QueryPerformanceCounter(&end);
+            ::QueryPerformanceFrequency(&frequency);
+
+            uint64 microseconds = (uint64)(end.QuadPart - start.QuadPart) * 1000000 / (uint64)frequency.QuadPart;
+            stats->lastPauseMicroseconds[phase] += microseconds;
+            stats->totalPauseMicroseconds[phase] += microseconds;
+            if (microseconds > stats->maxPauseMicroseconds)
+            {
+                stats->maxPauseMicroseconds = microseconds;
+            }
+        }
+    private:
+        RecyclerGCStats * stats;
+        RecyclerPausePhase phase;
+        bool isOutermost;
+        LARGE_INTEGER start;
+    };
+};
@@ -76,6 +76,51 @@ RecyclerHeuristic::UncollectedAllocBytesCollection()
     return DefaultUncollectedAllocBytesCollection;
 }
 
+void
+RecyclerHeuristic::InitializeSettings(RecyclerHeuristicSettings& settings, Js::ConfigFlagsTable& flags)
+{
+    settings.adaptive = flags.RecyclerAdaptiveHeuristic;
+    settings.heapGrowthPercent = DEFAULT_CONFIG_RecyclerHeapGrowthPercent;
+    settings.pauseTimePercent = DEFAULT_CONFIG_RecyclerPauseTimePercent;
+    settings.minCollectionBytes = DefaultMinAdaptiveCollectionBytes;
+    settings.maxCollectionBytes = Instance.MaxUncollectedAllocBytes;
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    if (flags.IsEnabled(Js::RecyclerHeapGrowthPercentFlag))
+    {
+        settings.heapGrowthPercent = flags.RecyclerHeapGrowthPercent;
+    }
+    if (flags.IsEnabled(Js::RecyclerPauseTimePercentFlag))
+    {
+        settings.pauseTimePercent = flags.RecyclerPauseTimePercent;
+    }
+#endif
+}
+
+size_t
+RecyclerHeuristic::AdaptiveUncollectedAllocBytesCollection(RecyclerHeuristicSettings const& settings,
+    size_t liveBytes, size_t allocBytes, uint allocTickCount, uint64 pauseMicroseconds)
+{
+    Assert(settings.adaptive);
+
+    // Let the heap grow in proportion to what survived, so big live heaps don't collect every MB
+    size_t collectionBytes = liveBytes / 100 * settings.heapGrowthPercent;
+
+    // If the last collection paused script for p, leave at least p * 100 / pauseTimePercent between
+    // collections, at the rate script allocated before the last collection. The interval is kept in
+    // microseconds since most pauses are shorter than a tick.
+    if (settings.pauseTimePercent != 0 && allocTickCount != 0)
+    {
+        uint64 intervalMicroseconds = pauseMicroseconds * 100 / settings.pauseTimePercent;
+        uint64 pauseCollectionBytes = allocBytes * intervalMicroseconds / ((uint64)allocTickCount * 1000);
+        if (pauseCollectionBytes > collectionBytes)
+        {
+            collectionBytes = (size_t)min(pauseCollectionBytes, (uint64)settings.maxCollectionBytes);
+        }
+    }
+
+    return min(max(collectionBytes, settings.minCollectionBytes), settings.maxCollectionBytes);
+}
+
 #if ENABLE_CONCURRENT_GC
 uint
 RecyclerHeuristic::MaxBackgroundFinishMarkCount(Js::ConfigFlagsTable& flags)
@@ -153,6 +198,12 @@ RecyclerHeuristic::PriorityBoostTimeout(Js::ConfigFlagsTable& flags)
 #endif
     return TickCountConcurrentPriorityBoost;
 }
+
+uint
+RecyclerHeuristic::MaxParallelism(Js::ConfigFlagsTable& flags)
+{
+    return max(flags.RecyclerMaxParallelism, 1);
+}
 #endif
 
 #if ENABLE_PARTIAL_GC && ENABLE_CONCURRENT_GC
@@ -10,6 +10,18 @@ namespace Memory
 #define MEGABYTES * 1024 KILOBYTES
 #define MEGABYTES_OF_PAGES * 1024 * 1024 / AutoSystemInfo::PageSize;
 
+// Per recycler collection policy. The fixed policy collects every UncollectedAllocBytesCollection
+// bytes once TickCountCollection has passed; the adaptive one sizes the next collection from what
+// the last one found live and from how fast script allocates (see AdaptiveUncollectedAllocBytesCollection).
+struct RecyclerHeuristicSettings
+{
+    bool adaptive;
+    uint heapGrowthPercent;         // Collect again once the heap grew by this much of what was live
+    uint pauseTimePercent;          // Space collections out so pauses stay under this much of the time
+    size_t minCollectionBytes;
+    size_t maxCollectionBytes;
+};
+
 class RecyclerHeuristic
 {
 private:
@@ -36,12 +48,16 @@ public:
 
     // Constant heuristic that may be changed by switches
     static uint UncollectedAllocBytesCollection();
+    static void InitializeSettings(RecyclerHeuristicSettings& settings, Js::ConfigFlagsTable& flags);
+    static size_t AdaptiveUncollectedAllocBytesCollection(RecyclerHeuristicSettings const& settings,
+        size_t liveBytes, size_t allocBytes, uint allocTickCount, uint64 pauseMicroseconds);
 #if ENABLE_CONCURRENT_GC
     static uint MaxBackgroundFinishMarkCount(Js::ConfigFlagsTable&);
     static DWORD BackgroundFinishMarkWaitTime(bool, Js::ConfigFlagsTable&);
     static size_t MinBackgroundRepeatMarkRescanBytes(Js::ConfigFlagsTable&);
     static DWORD FinishConcurrentCollectWaitTime(Js::ConfigFlagsTable&);
     static DWORD PriorityBoostTimeout(Js::ConfigFlagsTable&);
+    static uint MaxParallelism(Js::ConfigFlagsTable&);
 #endif
 #if ENABLE_PARTIAL_GC && ENABLE_CONCURRENT_GC
     static bool PartialConcurrentNextCollection(double ratio, Js::ConfigFlagsTable& flags);
@@ -68,6 +84,7 @@ private:
 #define RECYCLER_HEURISTIC_VERSION 11
 #endif
     static const uint DefaultUncollectedAllocBytesCollection = 1 MEGABYTES;
+    static const size_t DefaultMinAdaptiveCollectionBytes = 256 KILOBYTES;                  // Tiny heaps collect more often than with the fixed 1 MB
 
 #if ENABLE_CONCURRENT_GC
     static const uint TickCountConcurrentPriorityBoost = 5000;                              // 5 second
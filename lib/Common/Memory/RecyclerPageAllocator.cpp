@@ -39,12 +39,29 @@ RecyclerPageAllocator::EnableWriteWatch()
     Assert(decommitSegments.Empty());
     Assert(largeSegments.Empty());
 
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    if (hugePageSegments)
+    {
+        // The software write watch of the PAL write protects single pages, which would split the huge pages.
+        // Instead, every page of this allocator is treated as written (see HeapBlockMap32::Rescan).
+        return;
+    }
+#endif
+
     allocFlags = MEM_WRITE_WATCH;
 }
 
 bool
 RecyclerPageAllocator::ResetWriteWatch()
 {
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    if (hugePageSegments)
+    {
+        // Nothing to reset, see EnableWriteWatch
+        return true;
+    }
+#endif
+
     if (allocFlags != MEM_WRITE_WATCH)
     {
         return false;
@@ -82,15 +99,24 @@ RecyclerPageAllocator::ResetWriteWatch(DListBase<PageSegment> * segmentList)
         size_t pageCount = segment.GetAvailablePageCount();
         Assert(pageCount <= MAXUINT32);
         PageSegment::PageBitVector unallocPages = segment.GetUnAllocatedPages();
-        for (uint index = 0u; index < pageCount; index++)
+        uint index = 0u;
+        while (index < pageCount)
         {
             if (unallocPages.Test(index))
             {
+                index++;
                 continue;
             }
-            char * address = segment.GetAddress() + index * AutoSystemInfo::PageSize;
-            if (::ResetWriteWatch(address, AutoSystemInfo::PageSize) != 0)
 
+            // Reset each run of allocated pages with a single call
+            uint runEnd = index + 1;
+            while (runEnd < pageCount && !unallocPages.Test(runEnd))
+            {
+                runEnd++;
+            }
+
+            char * address = segment.GetAddress() + index * AutoSystemInfo::PageSize;
+            if (::ResetWriteWatch(address, (runEnd - index) * AutoSystemInfo::PageSize) != 0)
             {
 #if DBG_DUMP
                 Output::Print(_u("ResetWriteWatch failed for %p\n"), address);
@@ -100,6 +126,7 @@ RecyclerPageAllocator::ResetWriteWatch(DListBase<PageSegment> * segmentList)
                 Assert(false);
                 return false;
             }
+            index = runEnd;
         }
     }
     return true;
@@ -171,7 +198,7 @@ RecyclerPageAllocator::GetWriteWatchPageCount(DListBase<PageSegment> * segmentLi
             void * written;
             ULONG_PTR count = 0;
             DWORD pageSize = AutoSystemInfo::PageSize;
-            if (::GetWriteWatch(0, address, AutoSystemInfo::PageSize, &written, &count, &pageSize) == 0)
+            if (::GetWriteWatch(0, address, AutoSystemInfo::PageSize, &written, &count, &pageSize) != 0)
             {
 #if DBG_DUMP
                 Output::Print(_u("GetWriteWatch failed for %p\n"), segment.GetAddress());
@@ -197,7 +224,7 @@ size_t
 RecyclerPageAllocator::GetAllWriteWatchPageCount(DListBase<T> * segmentList)
 {
     size_t totalCount = 0;
-    DListBase<T>::Iterator it(segmentList);
+    typename DListBase<T>::Iterator it(segmentList);
     while (it.Next())
     {
         T& segment = it.Data();
@@ -207,7 +234,7 @@ RecyclerPageAllocator::GetAllWriteWatchPageCount(DListBase<T> * segmentList)
             void * written;
             ULONG_PTR count = 0;
             DWORD pageSize = AutoSystemInfo::PageSize;
-            if (::GetWriteWatch(0, address, AutoSystemInfo::PageSize, &written, &count, &pageSize) == 0)
+            if (::GetWriteWatch(0, address, AutoSystemInfo::PageSize, &written, &count, &pageSize) != 0)
             {
 #if DBG_DUMP
                 Output::Print(_u("GetWriteWatch failed for %p\n"), segment.GetAddress());
@@ -291,6 +291,36 @@ RecyclerSweep::IsBackground() const
     return this->background;
 }
 
+void
+RecyclerSweep::AddSweepBytes(HeapBlock::HeapBlockType blockType, size_t markedBytes, size_t sweptBytes)
+{
+    RecyclerHeapKind heapKind;
+    switch (blockType)
+    {
+    case HeapBlock::SmallLeafBlockType:
+    case HeapBlock::MediumLeafBlockType:
+        heapKind = RecyclerHeapKind_Leaf;
+        break;
+    case HeapBlock::SmallFinalizableBlockType:
+    case HeapBlock::MediumFinalizableBlockType:
+#ifdef RECYCLER_WRITE_BARRIER
+    case HeapBlock::SmallFinalizableBlockWithBarrierType:
+    case HeapBlock::MediumFinalizableBlockWithBarrierType:
+#endif
+        heapKind = RecyclerHeapKind_Finalizable;
+        break;
+    case HeapBlock::LargeBlockType:
+        heapKind = RecyclerHeapKind_Large;
+        break;
+    default:
+        heapKind = RecyclerHeapKind_Normal;
+        break;
+    }
+
+    this->liveBytes[heapKind] += markedBytes;
+    this->sweptBytes += sweptBytes;
+}
+
 bool
 RecyclerSweep::HasSetupBackgroundSweep() const
 {
@@ -450,6 +480,56 @@ RecyclerSweep::EndBackground()
     this->background = false;
 }
 
+void
+RecyclerSweep::BeginParallelSweep(RecyclerSweep * parallelOwner)
+{
+    if (parallelOwner != nullptr)
+    {
+        Assert(parallelOwner->parallelOwner == nullptr);
+
+        memset(this, 0, sizeof(RecyclerSweep));
+        this->recycler = parallelOwner->recycler;
+        this->parallelOwner = parallelOwner;
+        this->background = parallelOwner->background;
+        this->forceForeground = parallelOwner->forceForeground;
+        this->inPartialCollect = parallelOwner->inPartialCollect;
+#if ENABLE_PARTIAL_GC
+        Assert(!parallelOwner->InPartialCollectMode());
+        DebugOnly(this->partial = parallelOwner->partial);
+#endif
+    }
+
+    Assert(!this->parallel);
+    this->parallel = true;
+}
+
+void
+RecyclerSweep::EndParallelSweep()
+{
+    Assert(this->parallel);
+    this->parallel = false;
+
+    RecyclerSweep * parallelOwner = this->parallelOwner;
+    if (parallelOwner == nullptr)
+    {
+        return;
+    }
+
+    for (uint i = 0; i < RecyclerHeapKind_Count; i++)
+    {
+        parallelOwner->liveBytes[i] += this->liveBytes[i];
+    }
+    parallelOwner->sweptBytes += this->sweptBytes;
+    parallelOwner->hasPendingSweepSmallHeapBlocks |= this->hasPendingSweepSmallHeapBlocks;
+    parallelOwner->hasPendingEmptyBlocks |= this->hasPendingEmptyBlocks;
+#if ENABLE_PARTIAL_GC
+    parallelOwner->reuseHeapBlockCount += this->reuseHeapBlockCount;
+    parallelOwner->reuseByteCount += this->reuseByteCount;
+#endif
+
+    this->parallelOwner = nullptr;
+}
+
 #if DBG
 bool
 RecyclerSweep::HasPendingNewHeapBlocks() const
@@ -40,6 +40,14 @@ public:
     void BeginBackground(bool forceForeground);
     void EndBackground();
 
+    // Parallel sweep: the owner is the collection's RecyclerSweep, each of the other sweepers
+    // sweeps its own share of the buckets and folds its counters back into the owner when done.
+    void BeginParallelSweep(RecyclerSweep * parallelOwner);
+    void EndParallelSweep();
+    bool IsParallel() const { return this->parallel; }
+    template <typename TBlockType> void QueueParallelEmptyHeapBlock(HeapBucketT<TBlockType> const *heapBucket, TBlockType * heapBlock);
+    template <typename TBlockType> void FreeParallelEmptyHeapBlocks(HeapBucketT<TBlockType> * heapBucket);
+
     template <typename TBlockType> void SetPendingMergeNewHeapBlockList(TBlockType * heapBlockList);
     template <typename TBlockType> void MergePendingNewHeapBlockList();
     template <typename TBlockType> void MergePendingNewMediumHeapBlockList();
@@ -56,6 +64,10 @@ public:
 
     template <typename TBlockAttributes>
     void AddUnaccountedNewObjectAllocBytes(SmallHeapBlockT<TBlockAttributes> * smallHeapBlock);
+
+    void AddSweepBytes(HeapBlock::HeapBlockType blockType, size_t markedBytes, size_t sweptBytes);
+    size_t GetLiveBytes(RecyclerHeapKind heapKind) const { return liveBytes[heapKind]; }
+    size_t GetSweptBytes() const { return sweptBytes; }
 #if ENABLE_PARTIAL_GC
     bool InPartialCollectMode() const;
     bool InPartialCollect() const;
@@ -88,6 +100,7 @@ private:
 #if ENABLE_CONCURRENT_GC
         TBlockType * pendingEmptyBlockList;
         TBlockType * pendingEmptyBlockListTail;
+        TBlockType * pendingParallelEmptyBlockList;
 #if DBG
 
         TBlockType * savedNextAllocableBlockHead;
@@ -98,14 +111,20 @@ private:
     template <typename TBlockType>
     BucketData<TBlockType>& GetBucketData(HeapBucketT<TBlockType> const * bucket)
     {
+#if ENABLE_CONCURRENT_GC
+        // The bucket lists always live in the owner, so they can be found through recycler->recyclerSweep
+        RecyclerSweep * recyclerSweep = (this->parallelOwner != nullptr) ? this->parallelOwner : this;
+#else
+        RecyclerSweep * recyclerSweep = this;
+#endif
         if (TBlockType::HeapBlockAttributes::IsSmallBlock)
         {
-            return this->GetData<TBlockType>().bucketData[bucket->GetBucketIndex()];
+            return recyclerSweep->GetData<TBlockType>().bucketData[bucket->GetBucketIndex()];
         }
         else
         {
             Assert(TBlockType::HeapBlockAttributes::IsMediumBlock);
-            return this->GetData<TBlockType>().bucketData[bucket->GetMediumBucketIndex()];
+            return recyclerSweep->GetData<TBlockType>().bucketData[bucket->GetMediumBucketIndex()];
         }
     }
 
@@ -139,6 +158,9 @@ private:
     bool IsMemProtectMode();
 
     Recycler * recycler;
+#if ENABLE_CONCURRENT_GC
+    RecyclerSweep * parallelOwner;
+#endif
     Data<SmallLeafHeapBlock> leafData;
     Data<SmallNormalHeapBlock> normalData;
     Data<SmallFinalizableHeapBlock> finalizableData;
@@ -154,10 +176,15 @@ private:
     Data<MediumFinalizableWithBarrierHeapBlock> mediumFinalizableWithBarrierData;
 #endif
 
+    // Gathered while sweeping for RecyclerGCStats
+    size_t liveBytes[RecyclerHeapKind_Count];
+    size_t sweptBytes;
+
     bool background;
     bool forceForeground;
     bool hasPendingSweepSmallHeapBlocks;
     bool hasPendingEmptyBlocks;
+    bool parallel;
     bool inPartialCollect;
 #if ENABLE_PARTIAL_GC
     bool adjustPartialHeuristics;
@@ -250,6 +277,38 @@ RecyclerSweep::TransferPendingEmptyHeapBlocks(HeapBucketT<TBlockType> * heapBuck
     }
 }
 
+template <typename TBlockType>
+void
+RecyclerSweep::QueueParallelEmptyHeapBlock(HeapBucketT<TBlockType> const *heapBucket, TBlockType * heapBlock)
+{
+    // Pages can only be released on the thread that owns the page allocators, so in thread
+    // parallel sweepers leave the empty blocks for FreeParallelEmptyHeapBlocks
+    Assert(this->IsParallel() && !this->IsBackground());
+    Assert(heapBlock->heapBucket == heapBucket);
+    auto& bucketData = this->GetBucketData(heapBucket);
+    heapBlock->SetNextBlock(bucketData.pendingParallelEmptyBlockList);
+    bucketData.pendingParallelEmptyBlockList = heapBlock;
+}
+
+template <typename TBlockType>
+void
+RecyclerSweep::FreeParallelEmptyHeapBlocks(HeapBucketT<TBlockType> * heapBucket)
+{
+    Assert(!this->IsBackground());
+
+    auto& bucketData = this->GetBucketData(heapBucket);
+    TBlockType * list = bucketData.pendingParallelEmptyBlockList;
+    bucketData.pendingParallelEmptyBlockList = nullptr;
+
+    Recycler * recycler = this->recycler;
+    HeapBlockList::ForEachEditing(list, [heapBucket, recycler](TBlockType * heapBlock)
+    {
+        heapBlock->ReleasePagesSweep(recycler);
+        heapBucket->FreeHeapBlock(heapBlock);
+        RECYCLER_SLOW_CHECK(heapBucket->heapBlockCount--);
+    });
+}
+
 template <typename TBlockType>
 void
 RecyclerSweep::SetPendingMergeNewHeapBlockList(TBlockType * heapBlockList)
@@ -278,7 +337,8 @@ RecyclerSweep::GetHeapBlockCount(HeapBucketT<TBlockType> const * heapBucket)
 {
     auto& bucketData = this->GetBucketData(heapBucket);
     return HeapBlockList::Count(bucketData.pendingSweepList)
-        + HeapBlockList::Count(bucketData.pendingEmptyBlockList);
+        + HeapBlockList::Count(bucketData.pendingEmptyBlockList)
+        + HeapBlockList::Count(bucketData.pendingParallelEmptyBlockList);
 }
 #endif
 #endif
@@ -13,6 +13,7 @@ namespace Memory
 {
 // Forward declarations
 template <typename SizePolicy> class WeakReferenceHashTable;
+template <typename SizePolicy> class PartitionedWeakReferenceHashTable;
 class Recycler;
 
 ///
@@ -126,11 +127,34 @@ public:
         buckets = AllocatorNewArrayZ(HeapAllocator, allocator, RecyclerWeakReferenceBase*, this->size);
     }
 
+    // For tables kept in an array; Initialize must be called before the table is used
+    WeakReferenceHashTable():
+        allocator(nullptr),
+        buckets(nullptr),
+        count(0),
+        size(0),
+        freeList(nullptr)
+    {
+    }
+
+    void Initialize(uint size, HeapAllocator* allocator)
+    {
+        Assert(this->buckets == nullptr);
+        this->allocator = allocator;
+        this->size = SizePolicy::GetSize(size);
+        buckets = AllocatorNewArrayZ(HeapAllocator, allocator, RecyclerWeakReferenceBase*, this->size);
+    }
+
     ~WeakReferenceHashTable()
     {
-        AllocatorDeleteArray(HeapAllocator, allocator,  size, buckets);
+        if (buckets != nullptr)
+        {
+            AllocatorDeleteArray(HeapAllocator, allocator,  size, buckets);
+        }
     }
 
+    uint Count() const { return count; }
+
     RecyclerWeakReferenceBase* Add(char* strongReference, Recycler * recycler)
     {
         uint targetBucket = HashKeyToBucket(strongReference, size);
@@ -223,14 +247,20 @@ public:
         Remove(key, nullptr);
     }
 
+    // Calls fn on every entry and removes the ones it returns false for; returns how many were removed
     template <class Func>
-    void Map(Func fn)
+    uint Map(Func fn)
     {
         uint removed = 0;
 #if DEBUG
         uint countedEntries = 0;
 #endif
 
+        if (count == 0)
+        {
+            return 0;
+        }
+
         for (uint i=0;i<size;i++)
         {
             RecyclerWeakReferenceBase ** pprev = &buckets[i];
@@ -260,6 +290,7 @@ public:
 #if DEBUG
         Assert(countedEntries == count);
 #endif
+        return removed;
     }
 
 private:
@@ -369,4 +400,93 @@ private:
         return entry;
     }
 };
+
+///
+/// The recycler's map from strong references to weak references, split into partitions by the
+/// strong reference's address. Each partition is a WeakReferenceHashTable of its own, so growing
+/// the map rehashes one partition at a time, and the collector can clean up different partitions
+/// on different threads.
+///
+template <typename SizePolicy>
+class PartitionedWeakReferenceHashTable
+{
+public:
+    static const uint PartitionCount = 16;
+
+    PartitionedWeakReferenceHashTable(uint size, HeapAllocator* allocator)
+    {
+        for (uint i = 0; i < PartitionCount; i++)
+        {
+            partitions[i].Initialize(size / PartitionCount, allocator);
+        }
+    }
+
+    RecyclerWeakReferenceBase* Add(char* strongReference, Recycler * recycler)
+    {
+        return GetPartition(strongReference).Add(strongReference, recycler);
+    }
+
+    bool FindOrAdd(char* strongReference, Recycler *recycler, RecyclerWeakReferenceBase **ppWeakRef)
+    {
+        return GetPartition(strongReference).FindOrAdd(strongReference, recycler, ppWeakRef);
+    }
+
+    bool TryGetValue(char* strongReference, RecyclerWeakReferenceBase** weakReference)
+    {
+        return GetPartition(strongReference).TryGetValue(strongReference, weakReference);
+    }
+
+    void Remove(char* key)
+    {
+        GetPartition(key).Remove(key);
+    }
+
+    uint Count() const
+    {
+        uint count = 0;
+        for (uint i = 0; i < PartitionCount; i++)
+        {
+            count += partitions[i].Count();
+        }
+        return count;
+    }
+
+    template <class Func>
+    uint Map(Func fn)
+    {
+        uint removed = 0;
+        for (uint i = 0; i < PartitionCount; i++)
+        {
+            removed += partitions[i].Map(fn);
+        }
+        return removed;
+    }
+
+    // Partitions share nothing, so different threads may map different partitions at the same time
+    template <class Func>
+    uint MapPartition(uint partition, Func fn)
+    {
+        Assert(partition < PartitionCount);
+        return partitions[partition].Map(fn);
+    }
+
+#ifdef RECYCLER_TRACE_WEAKREF
+    void Dump()
+    {
+        for (uint i = 0; i < PartitionCount; i++)
+        {
+            partitions[i].Dump();
+        }
+    }
+#endif
+
+private:
+    WeakReferenceHashTable<SizePolicy>& GetPartition(char* strongReference)
+    {
+        // Recycler objects are at least ObjectGranularity aligned; consecutive objects go to different partitions
+        return partitions[(((size_t)strongReference) >> HeapConstants::ObjectAllocationShift) % PartitionCount];
+    }
+
+    WeakReferenceHashTable<SizePolicy> partitions[PartitionCount];
+};
 }
@@ -216,6 +216,7 @@ public:
     void PrepareSweep();
     void SetupBackgroundSweep(RecyclerSweep& recyclerSweep);
     void TransferPendingEmptyHeapBlocks(RecyclerSweep& recyclerSweep);
+    void FreeParallelEmptyHeapBlocks(RecyclerSweep& recyclerSweep);
 #endif
     void SweepFinalizableObjects(RecyclerSweep& recyclerSweep);
     void DisposeObjects();
@@ -25,4 +25,333 @@
 
 #include "ChakraDebug.h"
 
+    /// <summary>
+    ///     Why the garbage collector started a collection.
+    /// </summary>
+    typedef enum _JsGCTrigger
+    {
+        /// <summary>
+        ///     Enough was allocated, or enough time passed, since the last collection.
+        /// </summary>
+        JsGCTriggerHeuristic = 0,
+        /// <summary>
+        ///     An allocation failed, for example because the runtime reached its memory limit.
+        /// </summary>
+        JsGCTriggerMemoryLimit = 1,
+        /// <summary>
+        ///     The host called <c>JsIdle</c>.
+        /// </summary>
+        JsGCTriggerIdle = 2,
+        /// <summary>
+        ///     The host or script asked for a collection, or a context was closed.
+        /// </summary>
+        JsGCTriggerExplicit = 3
+    } JsGCTrigger;
+
+    /// <summary>
+    ///     The parts of a collection during which script can't run.
+    /// </summary>
+    typedef enum _JsGCPausePhase
+    {
+        /// <summary>
+        ///     Marking on the script thread, including the final rescan of a concurrent mark.
+        /// </summary>
+        JsGCPausePhaseMark = 0,
+        /// <summary>
+        ///     Sweeping on the script thread.
+        /// </summary>
+        JsGCPausePhaseSweep = 1,
+        /// <summary>
+        ///     Disposing of collected objects.
+        /// </summary>
+        JsGCPausePhaseDispose = 2
+    } JsGCPausePhase;
+
+    /// <summary>
+    ///     Kinds of garbage collected heap.
+    /// </summary>
+    typedef enum _JsGCHeapKind
+    {
+        /// <summary>
+        ///     Small and medium objects that may contain pointers.
+        /// </summary>
+        JsGCHeapKindNormal = 0,
+        /// <summary>
+        ///     Small and medium objects that contain no pointers.
+        /// </summary>
+        JsGCHeapKindLeaf = 1,
+        /// <summary>
+        ///     Small and medium objects that need finalizing.
+        /// </summary>
+        JsGCHeapKindFinalizable = 2,
+        /// <summary>
+        ///     Large objects.
+        /// </summary>
+        JsGCHeapKindLarge = 3
+    } JsGCHeapKind;
+
+    /// <summary>
+    ///     Garbage collector statistics for a runtime, see <c>JsGetRuntimeGCStats</c>.
+    /// </summary>
+    typedef struct _JsRuntimeGCStats
+    {
+        /// <summary>
+        ///     Number of collections started.
+        /// </summary>
+        unsigned int collectionCount;
+        /// <summary>
+        ///     Number of collections started, indexed by <c>JsGCTrigger</c>.
+        /// </summary>
+        unsigned int collectionCountByTrigger[4];
+        /// <summary>
+        ///     Why the last collection was started.
+        /// </summary>
+        JsGCTrigger lastTrigger;
+        /// <summary>
+        ///     Time script was paused by the last collection, in microseconds, indexed by <c>JsGCPausePhase</c>.
+        /// </summary>
+        uint64_t lastPauseMicroseconds[3];
+        /// <summary>
+        ///     Time script was paused by all collections, in microseconds, indexed by <c>JsGCPausePhase</c>.
+        /// </summary>
+        uint64_t totalPauseMicroseconds[3];
+        /// <summary>
+        ///     The longest single pause, in microseconds.
+        /// </summary>
+        uint64_t maxPauseMicroseconds;
+        /// <summary>
+        ///     Bytes found live by the last collection, indexed by <c>JsGCHeapKind</c>.
+        /// </summary>
+        size_t liveBytes[4];
+        /// <summary>
+        ///     Bytes freed by the last collection.
+        /// </summary>
+        size_t sweptBytes;
+        /// <summary>
+        ///     Bytes of physical memory under freed objects returned to the OS by all collections.
+        ///     Only counted when the runtime runs with <c>-RecyclerDiscardFreeObjectPages</c>.
+        /// </summary>
+        uint64_t discardedBytes;
+        /// <summary>
+        ///     Bytes to allocate before the garbage collector considers the next collection, as set
+        ///     by the collection policy (see <c>JsSetRuntimeGCHeuristics</c>).
+        /// </summary>
+        size_t nextCollectionBytes;
+        /// <summary>
+        ///     Number of collections that swept part of the heap on parallel threads.
+        /// </summary>
+        unsigned int parallelSweepCount;
+        /// <summary>
+        ///     Number of collections that cleaned up the weak reference table on parallel threads.
+        /// </summary>
+        unsigned int parallelWeakReferenceSweepCount;
+        /// <summary>
+        ///     Interpreter frames scanned precisely, instead of conservatively, when scanning the
+        ///     script thread's stack, over all collections.
+        /// </summary>
+        uint64_t preciseStackFrameCount;
+        /// <summary>
+        ///     Bytes of the frames in <c>preciseStackFrameCount</c>.
+        /// </summary>
+        uint64_t preciseStackFrameBytes;
+        /// <summary>
+        ///     Bytes of the frames in <c>preciseStackFrameCount</c> that didn't need scanning.
+        /// </summary>
+        uint64_t preciseStackSkippedBytes;
+    } JsRuntimeGCStats;
+
+    /// <summary>
+    ///     Gets garbage collector statistics for a runtime.
+    /// </summary>
+    /// <remarks>
+    ///     The statistics can be retrieved regardless of whether or not the runtime is active
+    ///     on another thread. While a collection is in progress they may be partly updated.
+    /// </remarks>
+    /// <param name="runtime">The runtime whose statistics are to be retrieved.</param>
+    /// <param name="stats">The runtime's garbage collector statistics.</param>
+    /// <returns>
+    ///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+    /// </returns>
+    CHAKRA_API
+        JsGetRuntimeGCStats(
+            _In_ JsRuntimeHandle runtime,
+            _Out_ JsRuntimeGCStats *stats);
+
+    /// <summary>
+    ///     Policies deciding when the garbage collector runs.
+    /// </summary>
+    typedef enum _JsGCHeuristicMode
+    {
+        /// <summary>
+        ///     Collect after a fixed amount of allocation, once enough time has passed.
+        /// </summary>
+        JsGCHeuristicModeDefault = 0,
+        /// <summary>
+        ///     Size the next collection from the bytes the last one found live and from how fast
+        ///     script allocates, so that the heap grows by a bounded factor and collection pauses
+        ///     stay under a share of the running time.
+        /// </summary>
+        JsGCHeuristicModeAdaptive = 1
+    } JsGCHeuristicMode;
+
+    /// <summary>
+    ///     Garbage collector heuristic settings for a runtime, see <c>JsSetRuntimeGCHeuristics</c>.
+    ///     Fields other than <c>mode</c> only apply to <c>JsGCHeuristicModeAdaptive</c>, and a zero
+    ///     field keeps the runtime's current value.
+    /// </summary>
+    typedef struct _JsGCHeuristicSettings
+    {
+        /// <summary>
+        ///     The collection policy.
+        /// </summary>
+        JsGCHeuristicMode mode;
+        /// <summary>
+        ///     Collect again once allocation since the last collection reaches this percentage of the live heap.
+        /// </summary>
+        unsigned int heapGrowthPercent;
+        /// <summary>
+        ///     Space collections out so that their pauses take at most this percentage of the running time.
+        /// </summary>
+        unsigned int pauseTimePercent;
+        /// <summary>
+        ///     The fewest bytes to allocate between collections.
+        /// </summary>
+        size_t minTriggerBytes;
+        /// <summary>
+        ///     The most bytes to allocate between collections.
+        /// </summary>
+        size_t maxTriggerBytes;
+    } JsGCHeuristicSettings;
+
+    /// <summary>
+    ///     Sets the policy deciding when the garbage collector of a runtime runs.
+    /// </summary>
+    /// <remarks>
+    ///     Requires the runtime to not be active on any thread. The settings take effect for the
+    ///     next collection.
+    /// </remarks>
+    /// <param name="runtime">The runtime whose collection policy is to be set.</param>
+    /// <param name="settings">The collection policy and its parameters.</param>
+    /// <returns>
+    ///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+    /// </returns>
+    CHAKRA_API
+        JsSetRuntimeGCHeuristics(
+            _In_ JsRuntimeHandle runtime,
+            _In_ const JsGCHeuristicSettings *settings);
+
+    /// <summary>
+    ///     Creates a new object that stores some external data, with a thread agnostic finalizer.
+    /// </summary>
+    /// <remarks>
+    ///     <para>
+    ///     Requires an active script context.
+    ///     </para>
+    ///     <para>
+    ///     Unlike with <c>JsCreateExternalObject</c>, the finalize callback may run on a background
+    ///     thread after the collection that freed the object, in a batch with other such callbacks,
+    ///     while script keeps running. It must not call any JSRT API or touch state that belongs to
+    ///     the script thread. The runtime runs it in thread instead when it does no background work,
+    ///     when it was created with a thread service callback, or when it is disposed. Every callback
+    ///     has run by the time <c>JsDisposeRuntime</c> returns.
+    ///     </para>
+    /// </remarks>
+    /// <param name="data">External data that the object will represent. May be null.</param>
+    /// <param name="finalizeCallback">
+    ///     A callback for when the object is finalized. May be null.
+    /// </param>
+    /// <param name="object">The new object.</param>
+    /// <returns>
+    ///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+    /// </returns>
+    CHAKRA_API
+        JsCreateExternalObjectWithThreadAgnosticFinalizer(
+            _In_opt_ void *data,
+            _In_opt_ JsFinalizeCallback finalizeCallback,
+            _Out_ JsValueRef *object);
+
+    /// <summary>
+    ///     Creates a Javascript ArrayBuffer object to access external memory, with a thread agnostic finalizer.
+    /// </summary>
+    /// <remarks>
+    ///     Requires an active script context. The finalize callback runs as described for
+    ///     <c>JsCreateExternalObjectWithThreadAgnosticFinalizer</c>.
+    /// </remarks>
+    /// <param name="data">A pointer to the external memory.</param>
+    /// <param name="byteLength">The number of bytes in the external memory.</param>
+    /// <param name="finalizeCallback">A callback for when the object is finalized. May be null.</param>
+    /// <param name="callbackState">User provided state that will be passed back to finalizeCallback.</param>
+    /// <param name="result">The new ArrayBuffer object.</param>
+    /// <returns>
+    ///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+    /// </returns>
+    CHAKRA_API
+        JsCreateExternalArrayBufferWithThreadAgnosticFinalizer(
+            _Pre_maybenull_ _Pre_writable_byte_size_(byteLength) void *data,
+            _In_ unsigned int byteLength,
+            _In_opt_ JsFinalizeCallback finalizeCallback,
+            _In_opt_ void *callbackState,
+            _Out_ JsValueRef *result);
+
+    /// <summary>
+    ///     Creates a string value over a UTF-16 buffer owned by the host, without copying it.
+    /// </summary>
+    /// <remarks>
+    ///     <para>
+    ///     Requires an active script context.
+    ///     </para>
+    ///     <para>
+    ///     The buffer must stay valid and unchanged until the finalize callback runs. It does not need
+    ///     to be null terminated; the engine copies it only when an operation needs a null terminated
+    ///     buffer.
+    ///     </para>
+    /// </remarks>
+    /// <param name="content">The string contents, as UTF-16 code units (16 bits wide on every platform).</param>
+    /// <param name="stringLength">The number of characters in the contents.</param>
+    /// <param name="finalizeCallback">A callback for when the string is finalized. May be null.</param>
+    /// <param name="callbackState">User provided state that will be passed back to finalizeCallback.</param>
+    /// <param name="string">The new string value.</param>
+    /// <returns>
+    ///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+    /// </returns>
+    CHAKRA_API
+        JsCreateExternalString(
+            _In_reads_(stringLength) const uint16_t *content,
+            _In_ size_t stringLength,
+            _In_opt_ JsFinalizeCallback finalizeCallback,
+            _In_opt_ void *callbackState,
+            _Out_ JsValueRef *string);
+
+    /// <summary>
+    ///     Creates a string value over a UTF-8 buffer owned by the host, without copying it.
+    /// </summary>
+    /// <remarks>
+    ///     <para>
+    ///     Requires an active script context.
+    ///     </para>
+    ///     <para>
+    ///     The buffer must stay valid and unchanged until the finalize callback runs. The engine
+    ///     transcodes it only when an operation needs the UTF-16 contents; all ASCII contents are
+    ///     hashed and compared in place.
+    ///     </para>
+    /// </remarks>
+    /// <param name="content">
+    ///     The string contents, encoded as UTF-8. Surrogate pairs encoded as two three-byte sequences
+    ///     (CESU-8) are accepted too.
+    /// </param>
+    /// <param name="byteLength">The number of bytes in the contents.</param>
+    /// <param name="finalizeCallback">A callback for when the string is finalized. May be null.</param>
+    /// <param name="callbackState">User provided state that will be passed back to finalizeCallback.</param>
+    /// <param name="string">The new string value.</param>
+    /// <returns>
+    ///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+    /// </returns>
+    CHAKRA_API
+        JsCreateExternalStringUtf8(
+            _In_reads_(byteLength) const char *content,
+            _In_ size_t byteLength,
+            _In_opt_ JsFinalizeCallback finalizeCallback,
+            _In_opt_ void *callbackState,
+            _Out_ JsValueRef *string);
+
 #endif // _CHAKRACORE_H_
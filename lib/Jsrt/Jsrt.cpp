@@ -6,6 +6,7 @@
 #include "JsrtInternal.h"
 #include "JsrtExternalObject.h"
 #include "JsrtExternalArrayBuffer.h"
+#include "JsrtExternalString.h"
 #include "jsrtHelper.h"
 
 #include "JsrtSourceHolder.h"
@@ -106,7 +107,7 @@ CHAKRA_API JsCreateRuntime(_In_ JsRuntimeAttributes attributes, _In_opt_ JsThrea
             )
         {
             threadContext->OptimizeForManyInstances(true);
-#if ENABLE_NATIVE_CODEGEN
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
             threadContext->EnableBgJit(false);
 #endif
         }
@@ -858,7 +859,44 @@ CHAKRA_API JsPointerToString(_In_reads_(stringLength) const wchar_t *stringValue
             Js::JavascriptError::ThrowOutOfMemoryError(scriptContext);
         }
 
-        *string = Js::JavascriptString::NewCopyBuffer(stringValue, static_cast<charcount_t>(stringLength), scriptContext);
+        *string = Js::Latin1String::NewCopyBufferIfLatin1(stringValue, static_cast<charcount_t>(stringLength), scriptContext);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsCreateExternalString(_In_reads_(stringLength) const uint16_t *content, _In_ size_t stringLength,
+    _In_opt_ JsFinalizeCallback finalizeCallback, _In_opt_ void *callbackState, _Out_ JsValueRef *string)
+{
+    return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        PARAM_NOT_NULL(content);
+        PARAM_NOT_NULL(string);
+
+        if (!Js::IsValidCharCount(stringLength))
+        {
+            Js::JavascriptError::ThrowOutOfMemoryError(scriptContext);
+        }
+
+        // UTF-16 code units on every platform, unlike wchar_t
+        static_assert(sizeof(char16) == sizeof(uint16_t), "char16 must be a UTF-16 code unit");
+        *string = Js::JsrtExternalString::New(reinterpret_cast<const char16 *>(content), static_cast<charcount_t>(stringLength), finalizeCallback, callbackState, scriptContext);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsCreateExternalStringUtf8(_In_reads_(byteLength) const char *content, _In_ size_t byteLength,
+    _In_opt_ JsFinalizeCallback finalizeCallback, _In_opt_ void *callbackState, _Out_ JsValueRef *string)
+{
+    return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        PARAM_NOT_NULL(content);
+        PARAM_NOT_NULL(string);
+
+        // A UTF-8 string never has more UTF-16 code units than bytes
+        if (!Js::IsValidCharCount(byteLength))
+        {
+            Js::JavascriptError::ThrowOutOfMemoryError(scriptContext);
+        }
+
+        *string = Js::JsrtExternalString::NewUtf8(reinterpret_cast<const utf8char_t *>(content), byteLength, finalizeCallback, callbackState, scriptContext);
         return JsNoError;
     });
 }
@@ -921,16 +959,26 @@ CHAKRA_API JsCreateObject(_Out_ JsValueRef *object)
     });
 }
 
-CHAKRA_API JsCreateExternalObject(_In_opt_ void *data, _In_opt_ JsFinalizeCallback finalizeCallback, _Out_ JsValueRef *object)
+JsErrorCode CreateExternalObject(void *data, JsFinalizeCallback finalizeCallback, bool isFinalizeThreadAgnostic, JsValueRef *object)
 {
     return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
         PARAM_NOT_NULL(object);
 
-        *object = RecyclerNewFinalized(scriptContext->GetRecycler(), JsrtExternalObject, RecyclerNew(scriptContext->GetRecycler(), JsrtExternalType, scriptContext, finalizeCallback), data);
+        *object = RecyclerNewFinalized(scriptContext->GetRecycler(), JsrtExternalObject, RecyclerNew(scriptContext->GetRecycler(), JsrtExternalType, scriptContext, finalizeCallback, isFinalizeThreadAgnostic), data);
         return JsNoError;
     });
 }
 
+CHAKRA_API JsCreateExternalObject(_In_opt_ void *data, _In_opt_ JsFinalizeCallback finalizeCallback, _Out_ JsValueRef *object)
+{
+    return CreateExternalObject(data, finalizeCallback, false, object);
+}
+
+CHAKRA_API JsCreateExternalObjectWithThreadAgnosticFinalizer(_In_opt_ void *data, _In_opt_ JsFinalizeCallback finalizeCallback, _Out_ JsValueRef *object)
+{
+    return CreateExternalObject(data, finalizeCallback, true, object);
+}
+
 CHAKRA_API JsConvertValueToObject(_In_ JsValueRef value, _Out_ JsValueRef *result)
 {
     return ContextAPIWrapper<true>([&] (Js::ScriptContext *scriptContext) -> JsErrorCode {
@@ -1163,8 +1211,8 @@ CHAKRA_API JsCreateArrayBuffer(_In_ unsigned int byteLength, _Out_ JsValueRef *r
     });
 }
 
-CHAKRA_API JsCreateExternalArrayBuffer(_Pre_maybenull_ _Pre_writable_byte_size_(byteLength) void *data, _In_ unsigned int byteLength,
-    _In_opt_ JsFinalizeCallback finalizeCallback, _In_opt_ void *callbackState, _Out_ JsValueRef *result)
+JsErrorCode CreateExternalArrayBuffer(void *data, unsigned int byteLength,
+    JsFinalizeCallback finalizeCallback, void *callbackState, bool isFinalizeThreadAgnostic, JsValueRef *result)
 {
     return ContextAPIWrapper<true>([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
         PARAM_NOT_NULL(result);
@@ -1180,6 +1228,7 @@ CHAKRA_API JsCreateExternalArrayBuffer(_Pre_maybenull_ _Pre_writable_byte_size_(
             byteLength,
             finalizeCallback,
             callbackState,
+            isFinalizeThreadAgnostic,
             library->GetArrayBufferType());
 
         JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_OBJECT(*result));
@@ -1187,6 +1236,18 @@ CHAKRA_API JsCreateExternalArrayBuffer(_Pre_maybenull_ _Pre_writable_byte_size_(
     });
 }
 
+CHAKRA_API JsCreateExternalArrayBuffer(_Pre_maybenull_ _Pre_writable_byte_size_(byteLength) void *data, _In_ unsigned int byteLength,
+    _In_opt_ JsFinalizeCallback finalizeCallback, _In_opt_ void *callbackState, _Out_ JsValueRef *result)
+{
+    return CreateExternalArrayBuffer(data, byteLength, finalizeCallback, callbackState, false, result);
+}
+
+CHAKRA_API JsCreateExternalArrayBufferWithThreadAgnosticFinalizer(_Pre_maybenull_ _Pre_writable_byte_size_(byteLength) void *data, _In_ unsigned int byteLength,
+    _In_opt_ JsFinalizeCallback finalizeCallback, _In_opt_ void *callbackState, _Out_ JsValueRef *result)
+{
+    return CreateExternalArrayBuffer(data, byteLength, finalizeCallback, callbackState, true, result);
+}
+
 CHAKRA_API JsCreateTypedArray(_In_ JsTypedArrayType arrayType, _In_ JsValueRef baseArray, _In_ unsigned int byteOffset,
     _In_ unsigned int elementLength, _Out_ JsValueRef *result)
 {
@@ -2102,6 +2163,117 @@ CHAKRA_API JsGetRuntimeMemoryUsage(_In_ JsRuntimeHandle runtimeHandle, _Out_ siz
     return JsNoError;
 }
 
+CHAKRA_API JsGetRuntimeGCStats(_In_ JsRuntimeHandle runtimeHandle, _Out_ JsRuntimeGCStats * stats)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+    PARAM_NOT_NULL(stats);
+    memset(stats, 0, sizeof(JsRuntimeGCStats));
+
+    CompileAssert(_countof(stats->collectionCountByTrigger) == RecyclerCollectTrigger_Count);
+    CompileAssert(JsGCTriggerExplicit == RecyclerCollectTrigger_Explicit);
+    CompileAssert(_countof(stats->lastPauseMicroseconds) == RecyclerPausePhase_Count);
+    CompileAssert(JsGCPausePhaseDispose == RecyclerPausePhase_Dispose);
+    CompileAssert(_countof(stats->liveBytes) == RecyclerHeapKind_Count);
+    CompileAssert(JsGCHeapKindLarge == RecyclerHeapKind_Large);
+
+    ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+    Recycler * recycler = threadContext->GetRecycler();
+    if (recycler == nullptr)
+    {
+        return JsNoError;
+    }
+
+    RecyclerGCStats gcStats;
+    recycler->GetGCStats(&gcStats);
+
+    stats->collectionCount = gcStats.collectionCount;
+    stats->lastTrigger = (JsGCTrigger)gcStats.lastTrigger;
+    for (uint i = 0; i < RecyclerCollectTrigger_Count; i++)
+    {
+        stats->collectionCountByTrigger[i] = gcStats.collectionCountByTrigger[i];
+    }
+    for (uint i = 0; i < RecyclerPausePhase_Count; i++)
+    {
+        stats->lastPauseMicroseconds[i] = gcStats.lastPauseMicroseconds[i];
+        stats->totalPauseMicroseconds[i] = gcStats.totalPauseMicroseconds[i];
+    }
+    stats->maxPauseMicroseconds = gcStats.maxPauseMicroseconds;
+    for (uint i = 0; i < RecyclerHeapKind_Count; i++)
+    {
+        stats->liveBytes[i] = gcStats.liveBytes[i];
+    }
+    stats->sweptBytes = gcStats.sweptBytes;
+    stats->discardedBytes = gcStats.discardedBytes;
+    stats->nextCollectionBytes = gcStats.nextCollectionBytes;
+    stats->parallelSweepCount = gcStats.parallelSweepCount;
+    stats->parallelWeakReferenceSweepCount = gcStats.parallelWeakReferenceSweepCount;
+    stats->preciseStackFrameCount = gcStats.preciseStackFrameCount;
+    stats->preciseStackFrameBytes = gcStats.preciseStackFrameBytes;
+    stats->preciseStackSkippedBytes = gcStats.preciseStackSkippedBytes;
+
+    return JsNoError;
+}
+
+CHAKRA_API JsSetRuntimeGCHeuristics(_In_ JsRuntimeHandle runtimeHandle, _In_ const JsGCHeuristicSettings * settings)
+{
+    return GlobalAPIWrapper([&] () -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+        PARAM_NOT_NULL(settings);
+
+        if (settings->mode != JsGCHeuristicModeDefault && settings->mode != JsGCHeuristicModeAdaptive)
+        {
+            return JsErrorInvalidArgument;
+        }
+        if (settings->pauseTimePercent > 100)
+        {
+            return JsErrorInvalidArgument;
+        }
+        if (settings->minTriggerBytes != 0 && settings->maxTriggerBytes != 0 && settings->minTriggerBytes > settings->maxTriggerBytes)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        // The recycler reads its settings while allocating, so they can only change while no thread runs script
+        if (!scope.IsValid() || scope.WasInUse())
+        {
+            return JsErrorRuntimeInUse;
+        }
+
+        Recycler * recycler = threadContext->EnsureRecycler();
+
+        RecyclerHeuristicSettings heuristicSettings;
+        recycler->GetHeuristicSettings(&heuristicSettings);
+
+        heuristicSettings.adaptive = (settings->mode == JsGCHeuristicModeAdaptive);
+        if (settings->heapGrowthPercent != 0)
+        {
+            heuristicSettings.heapGrowthPercent = settings->heapGrowthPercent;
+        }
+        if (settings->pauseTimePercent != 0)
+        {
+            heuristicSettings.pauseTimePercent = settings->pauseTimePercent;
+        }
+        if (settings->minTriggerBytes != 0)
+        {
+            heuristicSettings.minCollectionBytes = settings->minTriggerBytes;
+        }
+        if (settings->maxTriggerBytes != 0)
+        {
+            heuristicSettings.maxCollectionBytes = settings->maxTriggerBytes;
+        }
+        if (heuristicSettings.minCollectionBytes > heuristicSettings.maxCollectionBytes)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        recycler->SetHeuristicSettings(heuristicSettings);
+        return JsNoError;
+    });
+}
+
 CHAKRA_API JsSetRuntimeMemoryLimit(_In_ JsRuntimeHandle runtimeHandle, _In_ size_t memoryLimit)
 {
     VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
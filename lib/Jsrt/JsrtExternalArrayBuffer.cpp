@@ -3,25 +3,33 @@
 // Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
 //-------------------------------------------------------------------------------------------------------
 #include "JsrtPch.h"
+#include "jsrtHelper.h"
 #include "JsrtExternalArrayBuffer.h"
 
 namespace Js
 {
-    JsrtExternalArrayBuffer::JsrtExternalArrayBuffer(byte *buffer, uint32 length, JsFinalizeCallback finalizeCallback, void *callbackState, DynamicType *type)
-        : ExternalArrayBuffer(buffer, length, type), finalizeCallback(finalizeCallback), callbackState(callbackState)
+    JsrtExternalArrayBuffer::JsrtExternalArrayBuffer(byte *buffer, uint32 length, JsFinalizeCallback finalizeCallback, void *callbackState, bool isFinalizeThreadAgnostic, DynamicType *type)
+        : ExternalArrayBuffer(buffer, length, type), finalizeCallback(finalizeCallback), callbackState(callbackState), isFinalizeThreadAgnostic(isFinalizeThreadAgnostic)
     {
     }
 
-    JsrtExternalArrayBuffer* JsrtExternalArrayBuffer::New(byte *buffer, uint32 length, JsFinalizeCallback finalizeCallback, void *callbackState, DynamicType *type)
+    JsrtExternalArrayBuffer* JsrtExternalArrayBuffer::New(byte *buffer, uint32 length, JsFinalizeCallback finalizeCallback, void *callbackState, bool isFinalizeThreadAgnostic, DynamicType *type)
     {
         Recycler* recycler = type->GetScriptContext()->GetRecycler();
-        return RecyclerNewFinalized(recycler, JsrtExternalArrayBuffer, buffer, length, finalizeCallback, callbackState, type);
+        return RecyclerNewFinalized(recycler, JsrtExternalArrayBuffer, buffer, length, finalizeCallback, callbackState, isFinalizeThreadAgnostic, type);
     }
 
     void JsrtExternalArrayBuffer::Finalize(bool isShutdown)
     {
         if (finalizeCallback != nullptr)
         {
+            if (!isShutdown && isFinalizeThreadAgnostic)
+            {
+                Recycler* recycler = GetType()->GetLibrary()->GetRecycler();
+                recycler->FinalizeThreadAgnostic(&JsrtCallbackState::ThreadAgnosticFinalizeCallbackWrapper, (void *)finalizeCallback, callbackState);
+                return;
+            }
+
             finalizeCallback(callbackState);
         }
     }
@@ -11,15 +11,16 @@ namespace Js {
         DEFINE_VTABLE_CTOR(JsrtExternalArrayBuffer, ExternalArrayBuffer);
         DEFINE_MARSHAL_OBJECT_TO_SCRIPT_CONTEXT(JsrtExternalArrayBuffer);
 
-        JsrtExternalArrayBuffer(byte *buffer, uint32 length, JsFinalizeCallback finalizeCallback, void *callbackState, DynamicType *type);
+        JsrtExternalArrayBuffer(byte *buffer, uint32 length, JsFinalizeCallback finalizeCallback, void *callbackState, bool isFinalizeThreadAgnostic, DynamicType *type);
 
     public:
-        static JsrtExternalArrayBuffer* New(byte *buffer, uint32 length, JsFinalizeCallback finalizeCallback, void *callbackState, DynamicType *type);
+        static JsrtExternalArrayBuffer* New(byte *buffer, uint32 length, JsFinalizeCallback finalizeCallback, void *callbackState, bool isFinalizeThreadAgnostic, DynamicType *type);
         void Finalize(bool isShutdown) override;
 
     private:
         JsFinalizeCallback finalizeCallback;
         void *callbackState;
+        bool isFinalizeThreadAgnostic;      // The callback may run off the script thread
     };
     AUTO_REGISTER_RECYCLER_OBJECT_DUMPER(JsrtExternalArrayBuffer, &Js::RecyclableObject::DumpObjectFunction);
 }
@@ -7,7 +7,7 @@
 #include "JsrtExternalObject.h"
 #include "Types/PathTypeHandler.h"
 
-JsrtExternalType::JsrtExternalType(Js::ScriptContext* scriptContext, JsFinalizeCallback finalizeCallback)
+JsrtExternalType::JsrtExternalType(Js::ScriptContext* scriptContext, JsFinalizeCallback finalizeCallback, bool isFinalizeThreadAgnostic)
     : Js::DynamicType(
         scriptContext,
         Js::TypeIds_Object,
@@ -17,6 +17,7 @@ JsrtExternalType::JsrtExternalType(Js::ScriptContext* scriptContext, JsFinalizeC
         true,
         true)
         , jsFinalizeCallback(finalizeCallback)
+        , isFinalizeThreadAgnostic(isFinalizeThreadAgnostic)
 {
 }
 
@@ -48,6 +49,14 @@ void JsrtExternalObject::Finalize(bool isShutdown)
     JsFinalizeCallback finalizeCallback = this->GetExternalType()->GetJsFinalizeCallback();
     if (nullptr != finalizeCallback)
     {
+        if (!isShutdown && this->GetExternalType()->IsFinalizeThreadAgnostic())
+        {
+            // Use the recycler off the library, the script context may be gone already
+            Recycler * recycler = this->GetExternalType()->GetLibrary()->GetRecycler();
+            recycler->FinalizeThreadAgnostic(&JsrtCallbackState::ThreadAgnosticFinalizeCallbackWrapper, (void *)finalizeCallback, this->slot);
+            return;
+        }
+
         JsrtCallbackState scope(nullptr);
         finalizeCallback(this->slot);
     }
@@ -27,14 +27,17 @@
 class JsrtExternalType sealed : public Js::DynamicType
 {
 public:
-    JsrtExternalType(JsrtExternalType *type) : Js::DynamicType(type), jsFinalizeCallback(type->jsFinalizeCallback) {}
-    JsrtExternalType(Js::ScriptContext* scriptContext, JsFinalizeCallback finalizeCallback);
+    JsrtExternalType(JsrtExternalType *type) : Js::DynamicType(type), jsFinalizeCallback(type->jsFinalizeCallback), isFinalizeThreadAgnostic(type->isFinalizeThreadAgnostic) {}
+    JsrtExternalType(Js::ScriptContext* scriptContext, JsFinalizeCallback finalizeCallback, bool isFinalizeThreadAgnostic);
 
     //Js::PropertyId GetNameId() const { return ((Js::PropertyRecord *)typeDescription.className)->GetPropertyId(); }
     JsFinalizeCallback GetJsFinalizeCallback() const { return this->jsFinalizeCallback; }
+    // The callback may run off the script thread (JsCreateExternalObjectWithThreadAgnosticFinalizer)
+    bool IsFinalizeThreadAgnostic() const { return this->isFinalizeThreadAgnostic; }
 
 private:
     JsFinalizeCallback jsFinalizeCallback;
+    bool isFinalizeThreadAgnostic;
 };
 AUTO_REGISTER_RECYCLER_OBJECT_DUMPER(JsrtExternalType, &Js::Type::DumpObjectFunction);
 
@@ -0,0 +1,120 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "JsrtPch.h"
+#include "jsrtHelper.h"
+#include "JsrtExternalString.h"
+
+namespace Js
+{
+    JsrtExternalString::JsrtExternalString(const char16 *content, const utf8char_t *utf8Content, size_t utf8ByteLength, bool isUtf8Ascii,
+        charcount_t length, JsFinalizeCallback finalizeCallback, void *callbackState, ScriptContext *scriptContext)
+        : JavascriptString(scriptContext->GetLibrary()->GetStringTypeStatic()),
+        utf8Content(utf8Content), utf8ByteLength(utf8ByteLength), isUtf8Ascii(isUtf8Ascii), isHostBuffer(content != nullptr),
+        finalizeCallback(finalizeCallback), callbackState(callbackState)
+    {
+        Assert((content == nullptr) != (utf8Content == nullptr));
+        if (content != nullptr)
+        {
+            this->SetBuffer(content);
+        }
+        this->SetLength(length);
+    }
+
+    JsrtExternalString* JsrtExternalString::New(const char16 *content, charcount_t length, JsFinalizeCallback finalizeCallback, void *callbackState, ScriptContext *scriptContext)
+    {
+        Assert(content != nullptr);
+        Recycler* recycler = scriptContext->GetRecycler();
+        return RecyclerNewFinalized(recycler, JsrtExternalString, content, nullptr, 0, false, length, finalizeCallback, callbackState, scriptContext);
+    }
+
+    JsrtExternalString* JsrtExternalString::NewUtf8(const utf8char_t *content, size_t byteLength, JsFinalizeCallback finalizeCallback, void *callbackState, ScriptContext *scriptContext)
+    {
+        Assert(content != nullptr);
+
+        bool isAscii = true;
+        for (size_t i = 0; i < byteLength; i++)
+        {
+            if (content[i] >= 0x80)
+            {
+                isAscii = false;
+                break;
+            }
+        }
+
+        // Every UTF-8 byte decodes to at most one char16, so the length fits whenever the byte count does.
+        // Surrogates encoded one at a time (CESU-8, as utf8::EncodeInto produces) decode to the same pair.
+        charcount_t length = isAscii ? static_cast<charcount_t>(byteLength) : utf8::ByteIndexIntoCharacterIndex(content, byteLength, utf8::doAllowThreeByteSurrogates);
+
+        Recycler* recycler = scriptContext->GetRecycler();
+        return RecyclerNewFinalized(recycler, JsrtExternalString, nullptr, content, byteLength, isAscii, length, finalizeCallback, callbackState, scriptContext);
+    }
+
+    const char16* JsrtExternalString::GetSz()
+    {
+        if (isHostBuffer)
+        {
+            // The host buffer need not be null terminated
+            Recycler* recycler = this->GetScriptContext()->GetRecycler();
+            this->SetBuffer(AllocateLeafAndCopySz(recycler, UnsafeGetBuffer(), GetLength()));
+            isHostBuffer = false;
+        }
+        else if (utf8Content != nullptr)
+        {
+            Recycler* recycler = this->GetScriptContext()->GetRecycler();
+            char16 * buffer = RecyclerNewArrayLeaf(recycler, char16, GetLength() + 1);
+            LPCUTF8 source = utf8Content;
+            size_t decodedLength = utf8::DecodeUnitsIntoAndNullTerminate(buffer, source, utf8Content + utf8ByteLength, utf8::doAllowThreeByteSurrogates);
+            Assert(decodedLength == GetLength());
+            Unused(decodedLength);
+            this->SetBuffer(buffer);
+            utf8Content = nullptr;
+        }
+
+        return UnsafeGetBuffer();
+    }
+
+    const unsigned char * JsrtExternalString::GetLatin1Buffer() const
+    {
+        return isUtf8Ascii ? utf8Content : nullptr;
+    }
+
+    size_t JsrtExternalString::GetAllocatedByteCount() const
+    {
+        if (isHostBuffer || utf8Content != nullptr)
+        {
+            return 0;
+        }
+        return __super::GetAllocatedByteCount();
+    }
+
+    void JsrtExternalString::CopyVirtual(
+        _Out_writes_(m_charLength) char16 *const buffer,
+        StringCopyInfoStack &nestedStringTreeCopyInfos,
+        const byte recursionDepth)
+    {
+        Assert(buffer);
+        Assert(!this->IsFinalized());
+        Assert(utf8Content != nullptr);
+
+        // Transcode straight into the destination, the string itself stays UTF-8
+        LPCUTF8 source = utf8Content;
+        size_t decodedLength = utf8::DecodeUnitsInto(buffer, source, utf8Content + utf8ByteLength, utf8::doAllowThreeByteSurrogates);
+        Assert(decodedLength == GetLength());
+        Unused(decodedLength);
+    }
+
+    void JsrtExternalString::Finalize(bool isShutdown)
+    {
+        if (finalizeCallback != nullptr)
+        {
+            JsrtCallbackState scope(nullptr);
+            finalizeCallback(callbackState);
+        }
+    }
+
+    void JsrtExternalString::Dispose(bool isShutdown)
+    {
+    }
+}
@@ -0,0 +1,43 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js {
+    // A string over an immutable buffer owned by the host. UTF-16 contents are used in place, and
+    // only copied when a null terminated buffer is asked for. UTF-8 contents are transcoded when
+    // the string is flattened or needs a char16 buffer; until then an all ASCII buffer is hashed
+    // and compared as a one-byte string. The host is told through the finalize callback once the
+    // string has been collected and the buffer is no longer referenced.
+    class JsrtExternalString sealed : public JavascriptString
+    {
+    protected:
+        DEFINE_VTABLE_CTOR(JsrtExternalString, JavascriptString);
+        DECLARE_CONCRETE_STRING_CLASS;
+
+        JsrtExternalString(const char16 *content, const utf8char_t *utf8Content, size_t utf8ByteLength, bool isUtf8Ascii,
+            charcount_t length, JsFinalizeCallback finalizeCallback, void *callbackState, ScriptContext *scriptContext);
+
+    public:
+        static JsrtExternalString* New(const char16 *content, charcount_t length, JsFinalizeCallback finalizeCallback, void *callbackState, ScriptContext *scriptContext);
+        static JsrtExternalString* NewUtf8(const utf8char_t *content, size_t byteLength, JsFinalizeCallback finalizeCallback, void *callbackState, ScriptContext *scriptContext);
+
+        virtual const char16* GetSz() override;
+        virtual const unsigned char * GetLatin1Buffer() const override;
+        virtual size_t GetAllocatedByteCount() const override;
+        virtual void CopyVirtual(_Out_writes_(m_charLength) char16 *const buffer, StringCopyInfoStack &nestedStringTreeCopyInfos, const byte recursionDepth) override;
+
+        void Finalize(bool isShutdown) override;
+        void Dispose(bool isShutdown) override;
+
+    private:
+        const utf8char_t *utf8Content;      // Host UTF-8 buffer until the string is transcoded
+        size_t utf8ByteLength;
+        bool isUtf8Ascii;
+        bool isHostBuffer;                  // The char16 buffer is the host's and isn't null terminated
+        JsFinalizeCallback finalizeCallback;
+        void *callbackState;
+    };
+    AUTO_REGISTER_RECYCLER_OBJECT_DUMPER(JsrtExternalString, &Js::RecyclableObject::DumpObjectFunction);
+}
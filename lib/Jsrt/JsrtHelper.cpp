@@ -49,3 +49,9 @@ void JsrtCallbackState::ObjectBeforeCallectCallbackWrapper(JsObjectBeforeCollect
     JsrtCallbackState scope(reinterpret_cast<ThreadContext*>(threadContext));
     callback(object, callbackState);
 }
+
+// Runs on the recycler's background finalizer thread, where there is no JSRT state to save
+void JsrtCallbackState::ThreadAgnosticFinalizeCallbackWrapper(void* callback, void* data)
+{
+    reinterpret_cast<JsFinalizeCallback>(callback)(data);
+}
@@ -10,6 +10,7 @@ public:
     JsrtCallbackState(ThreadContext* currentThreadContext);
     ~JsrtCallbackState();
     static void ObjectBeforeCallectCallbackWrapper(JsObjectBeforeCollectCallback callback, void* object, void* callbackState, void* threadContext);
+    static void ThreadAgnosticFinalizeCallbackWrapper(void* callback, void* data);
 private:
     ThreadContext* originalThreadContext;
     JsrtContext* originalJsrtContext;
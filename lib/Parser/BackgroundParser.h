@@ -4,7 +4,7 @@
 //-------------------------------------------------------------------------------------------------------
 #pragma once
 
-#if ENABLE_NATIVE_CODEGEN
+#if ENABLE_BACKGROUND_PARSING
 typedef DList<ParseNode*, ArenaAllocator> NodeDList;
 
 struct BackgroundParseItem sealed : public JsUtil::Job
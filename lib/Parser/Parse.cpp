@@ -71,12 +71,14 @@ Parser::Parser(Js::ScriptContext* scriptContext, BOOL strictMode, PageAllocator
 #else
 Parser::Parser(Js::ScriptContext* scriptContext, BOOL strictMode, PageAllocator *alloc, bool isBackground)
 #endif
-    : m_nodeAllocator(_u("Parser"), alloc ? alloc : scriptContext->GetThreadContext()->GetPageAllocator(), Parser::OutOfMemory),
+    : m_localNodeAllocator(_u("Parser"), alloc ? alloc : scriptContext->GetThreadContext()->GetPageAllocator(), Parser::OutOfMemory),
     // use the GuestArena directly for keeping the RegexPattern* alive during byte code generation
     m_registeredRegexPatterns(scriptContext->GetGuestArena())
 {
     AssertMsg(size == sizeof(Parser), "verify conditionals affecting the size of Parser agree");
     Assert(scriptContext != nullptr);
+    // Parsers on the script thread take their node arena, with pages left from earlier parses, from the thread context
+    m_nodeAllocator = alloc == nullptr ? scriptContext->GetThreadContext()->GetParserArena() : &m_localNodeAllocator;
     m_isInBackground = isBackground;
     m_phtbl = nullptr;
     m_pscan = nullptr;
@@ -156,6 +158,10 @@ Parser::~Parser(void)
 
     Release();
 
+    if (m_nodeAllocator != &m_localNodeAllocator)
+    {
+        m_scriptContext->GetThreadContext()->ReleaseParserArena(m_nodeAllocator);
+    }
 }
 
 void Parser::OutOfMemory()
@@ -652,7 +658,7 @@ LabelId* Parser::CreateLabelId(IdentToken* pToken)
 {
     LabelId* pLabelId;
 
-    pLabelId = (LabelId*)m_nodeAllocator.Alloc(sizeof(LabelId));
+    pLabelId = (LabelId*)m_nodeAllocator->Alloc(sizeof(LabelId));
     if (NULL == pLabelId)
         Error(ERRnoMemory);
     pLabelId->pid = pToken->pid;
@@ -721,7 +727,7 @@ template <OpCode nop>
 ParseNodePtr Parser::CreateNodeT(charcount_t ichMin,charcount_t ichLim)
 {
     Assert(!this->m_deferringAST);
-    ParseNodePtr pnode = StaticCreateNodeT<nop>(&m_nodeAllocator, ichMin, ichLim);
+    ParseNodePtr pnode = StaticCreateNodeT<nop>(m_nodeAllocator, ichMin, ichLim);
 
     Assert(m_pCurrentAstSize != NULL);
     *m_pCurrentAstSize += GetNodeSize<nop>();
@@ -897,7 +903,7 @@ Symbol* Parser::AddDeclForPid(ParseNodePtr pnode, IdentPtr pid, SymbolType symbo
         if (scope == nullptr)
         {
             Assert(blockInfo->pnodeBlock->sxBlock.blockType == PnodeBlockType::Regular);
-            scope = Anew(&m_nodeAllocator, Scope, &m_nodeAllocator, ScopeType_Block);
+            scope = Anew(m_nodeAllocator, Scope, m_nodeAllocator, ScopeType_Block);
             blockInfo->pnodeBlock->sxBlock.scope = scope;
             PushScope(scope);
         }
@@ -949,7 +955,7 @@ Symbol* Parser::AddDeclForPid(ParseNodePtr pnode, IdentPtr pid, SymbolType symbo
             SymbolName const symName(name, nameLength);
 
             Assert(!scope->FindLocalSymbol(symName));
-            sym = Anew(&m_nodeAllocator, Symbol, symName, pnode, symbolType);
+            sym = Anew(m_nodeAllocator, Symbol, symName, pnode, symbolType);
             scope->AddNewSymbol(sym);
             sym->SetPid(pid);
         }
@@ -1046,7 +1052,7 @@ ParseNodePtr Parser::CreateNode(OpCode nop, charcount_t ichMin)
     ParseNodePtr pnode;
     int cb = (nop >= knopNone && nop < knopLim) ? g_mpnopcbNode[nop] : g_mpnopcbNode[knopEmpty];
 
-    pnode = (ParseNodePtr)m_nodeAllocator.Alloc(cb);
+    pnode = (ParseNodePtr)m_nodeAllocator->Alloc(cb);
     Assert(pnode != nullptr);
 
     if (!m_deferringAST)
@@ -1071,7 +1077,7 @@ ParseNodePtr Parser::CreateUniNode(OpCode nop, ParseNodePtr pnode1)
 {
     Assert(!this->m_deferringAST);
     DebugOnly(VerifyNodeSize(nop, kcbPnUni));
-    ParseNodePtr pnode = (ParseNodePtr)m_nodeAllocator.Alloc(kcbPnUni);
+    ParseNodePtr pnode = (ParseNodePtr)m_nodeAllocator->Alloc(kcbPnUni);
 
     Assert(m_pCurrentAstSize != nullptr);
     *m_pCurrentAstSize += kcbPnUni;
@@ -1174,7 +1180,7 @@ ParseNodePtr Parser::CreateTriNode(OpCode nop, ParseNodePtr pnode1,
 
 ParseNodePtr Parser::CreateBlockNode(charcount_t ichMin,charcount_t ichLim, PnodeBlockType blockType)
 {
-    return StaticCreateBlockNode(&m_nodeAllocator, ichMin, ichLim, this->m_nextBlockId++, blockType);
+    return StaticCreateBlockNode(m_nodeAllocator, ichMin, ichLim, this->m_nextBlockId++, blockType);
 }
 
 ParseNodePtr
@@ -1182,7 +1188,7 @@ Parser::CreateCallNode(OpCode nop, ParseNodePtr pnode1, ParseNodePtr pnode2,char
 {
     Assert(!this->m_deferringAST);
     DebugOnly(VerifyNodeSize(nop, kcbPnCall));
-    ParseNodePtr pnode = (ParseNodePtr)m_nodeAllocator.Alloc(kcbPnCall);
+    ParseNodePtr pnode = (ParseNodePtr)m_nodeAllocator->Alloc(kcbPnCall);
 
     Assert(m_pCurrentAstSize != nullptr);
     *m_pCurrentAstSize += kcbPnCall;
@@ -1441,7 +1447,7 @@ ParseNodePtr Parser::StartParseBlockWithCapacity(PnodeBlockType blockType, Scope
     // Block scopes are created lazily when we discover block-scoped content.
     if (scopeType != ScopeType_Unknown && scopeType != ScopeType_Block)
     {
-        scope = Anew(&m_nodeAllocator, Scope, &m_nodeAllocator, scopeType, capacity);
+        scope = Anew(m_nodeAllocator, Scope, m_nodeAllocator, scopeType, capacity);
         PushScope(scope);
     }
 
@@ -1455,7 +1461,7 @@ ParseNodePtr Parser::StartParseBlock(PnodeBlockType blockType, ScopeType scopeTy
     // Block scopes are created lazily when we discover block-scoped content.
     if (scopeType != ScopeType_Unknown && scopeType != ScopeType_Block)
     {
-        scope = Anew(&m_nodeAllocator, Scope, &m_nodeAllocator, scopeType);
+        scope = Anew(m_nodeAllocator, Scope, m_nodeAllocator, scopeType);
         PushScope(scope);
     }
 
@@ -1716,7 +1722,7 @@ void Parser::PopStmt(StmtNest *pStmt)
 
 BlockInfoStack *Parser::PushBlockInfo(ParseNodePtr pnodeBlock)
 {
-    BlockInfoStack *newBlockInfo = (BlockInfoStack *)m_nodeAllocator.Alloc(sizeof(BlockInfoStack));
+    BlockInfoStack *newBlockInfo = (BlockInfoStack *)m_nodeAllocator->Alloc(sizeof(BlockInfoStack));
     Assert(nullptr != newBlockInfo);
 
     newBlockInfo->pnodeBlock = pnodeBlock;
@@ -1752,7 +1758,7 @@ void Parser::PushDynamicBlock()
     {
         return;
     }
-    BlockIdsStack *info = (BlockIdsStack *)m_nodeAllocator.Alloc(sizeof(BlockIdsStack));
+    BlockIdsStack *info = (BlockIdsStack *)m_nodeAllocator->Alloc(sizeof(BlockIdsStack));
     if (nullptr == info)
     {
         Error(ERRnoMemory);
@@ -2156,7 +2162,7 @@ IdentPtrList* Parser::EnsureRequestedModulesList()
 {
     if (m_currentNodeProg->sxModule.requestedModules == nullptr)
     {
-        m_currentNodeProg->sxModule.requestedModules = Anew(&m_nodeAllocator, IdentPtrList, &m_nodeAllocator);
+        m_currentNodeProg->sxModule.requestedModules = Anew(m_nodeAllocator, IdentPtrList, m_nodeAllocator);
     }
     return m_currentNodeProg->sxModule.requestedModules;
 }
@@ -2165,7 +2171,7 @@ ModuleImportOrExportEntryList* Parser::EnsureModuleImportEntryList()
 {
     if (m_currentNodeProg->sxModule.importEntries == nullptr)
     {
-        m_currentNodeProg->sxModule.importEntries = Anew(&m_nodeAllocator, ModuleImportOrExportEntryList, &m_nodeAllocator);
+        m_currentNodeProg->sxModule.importEntries = Anew(m_nodeAllocator, ModuleImportOrExportEntryList, m_nodeAllocator);
     }
     return m_currentNodeProg->sxModule.importEntries;
 }
@@ -2174,7 +2180,7 @@ ModuleImportOrExportEntryList* Parser::EnsureModuleLocalExportEntryList()
 {
     if (m_currentNodeProg->sxModule.localExportEntries == nullptr)
     {
-        m_currentNodeProg->sxModule.localExportEntries = Anew(&m_nodeAllocator, ModuleImportOrExportEntryList, &m_nodeAllocator);
+        m_currentNodeProg->sxModule.localExportEntries = Anew(m_nodeAllocator, ModuleImportOrExportEntryList, m_nodeAllocator);
     }
     return m_currentNodeProg->sxModule.localExportEntries;
 }
@@ -2183,7 +2189,7 @@ ModuleImportOrExportEntryList* Parser::EnsureModuleIndirectExportEntryList()
 {
     if (m_currentNodeProg->sxModule.indirectExportEntries == nullptr)
     {
-        m_currentNodeProg->sxModule.indirectExportEntries = Anew(&m_nodeAllocator, ModuleImportOrExportEntryList, &m_nodeAllocator);
+        m_currentNodeProg->sxModule.indirectExportEntries = Anew(m_nodeAllocator, ModuleImportOrExportEntryList, m_nodeAllocator);
     }
     return m_currentNodeProg->sxModule.indirectExportEntries;
 }
@@ -2192,7 +2198,7 @@ ModuleImportOrExportEntryList* Parser::EnsureModuleStarExportEntryList()
 {
     if (m_currentNodeProg->sxModule.starExportEntries == nullptr)
     {
-        m_currentNodeProg->sxModule.starExportEntries = Anew(&m_nodeAllocator, ModuleImportOrExportEntryList, &m_nodeAllocator);
+        m_currentNodeProg->sxModule.starExportEntries = Anew(m_nodeAllocator, ModuleImportOrExportEntryList, m_nodeAllocator);
     }
     return m_currentNodeProg->sxModule.starExportEntries;
 }
@@ -2221,7 +2227,7 @@ ModuleImportOrExportEntry* Parser::AddModuleImportOrExportEntry(ModuleImportOrEx
 
 ModuleImportOrExportEntry* Parser::AddModuleImportOrExportEntry(ModuleImportOrExportEntryList* importOrExportEntryList, IdentPtr importName, IdentPtr localName, IdentPtr exportName, IdentPtr moduleRequest)
 {
-    ModuleImportOrExportEntry* importOrExportEntry = Anew(&m_nodeAllocator, ModuleImportOrExportEntry);
+    ModuleImportOrExportEntry* importOrExportEntry = Anew(m_nodeAllocator, ModuleImportOrExportEntry);
 
     importOrExportEntry->importName = importName;
     importOrExportEntry->localName = localName;
@@ -2377,7 +2383,7 @@ ParseNodePtr Parser::ParseImportDeclaration()
     }
     else
     {
-        ModuleImportOrExportEntryList importEntryList(&m_nodeAllocator);
+        ModuleImportOrExportEntryList importEntryList(m_nodeAllocator);
 
         // Parse the import clause (default binding can only exist before the comma).
         ParseImportClause<buildAST>(&importEntryList);
@@ -2611,7 +2617,7 @@ ParseNodePtr Parser::ParseExportDeclaration()
 
     case tkLCurly:
         {
-            ModuleImportOrExportEntryList exportEntryList(&m_nodeAllocator);
+            ModuleImportOrExportEntryList exportEntryList(m_nodeAllocator);
 
             ParseNamedImportOrExportClause<buildAST>(&exportEntryList, true);
 
@@ -3930,7 +3936,7 @@ ParseNodePtr Parser::ParseMemberList(LPCOLESTR pNameHint, uint32* pNameHintLengt
         return nullptr;
     }
 
-    ArenaAllocator tempAllocator(_u("MemberNames"), m_nodeAllocator.GetPageAllocator(), Parser::OutOfMemory);
+    ArenaAllocator tempAllocator(_u("MemberNames"), m_nodeAllocator->GetPageAllocator(), Parser::OutOfMemory);
 
     bool hasDeferredInitError = false;
 
@@ -4745,7 +4751,7 @@ bool Parser::ParseFncDeclHelper(ParseNodePtr pnodeFnc, ParseNodePtr pnodeFncPare
     {
         FinishParseBlock(pnodeFncExprScope);
         m_nextBlockId--;
-        Adelete(&m_nodeAllocator, fncExprScope);
+        Adelete(m_nodeAllocator, fncExprScope);
         fncExprScope = nullptr;
         pnodeFncExprScope = nullptr;
     }
@@ -5698,7 +5704,7 @@ void Parser::ParseNestedDeferredFunc(ParseNodePtr pnodeFnc, bool fLambda, bool *
         // Record the end of the function and the function ID increment that happens inside the function.
         // Byte code gen will use this to build stub information to allow us to skip this function when the
         // enclosing function is fully parsed.
-        RestorePoint *restorePoint = Anew(&m_nodeAllocator, RestorePoint);
+        RestorePoint *restorePoint = Anew(m_nodeAllocator, RestorePoint);
         m_pscan->Capture(restorePoint,
                          *m_nextFunctionId - pnodeFnc->sxFnc.functionId - 1,
                          lengthBeforeBody - this->GetSourceLength());
@@ -5944,7 +5950,7 @@ void Parser::ParseFncFormals(ParseNodePtr pnodeFnc, ushort flags)
         {
             Error(ERRGetterMustHaveNoParameters);
         }
-        SList<IdentPtr> formals(&m_nodeAllocator);
+        SList<IdentPtr> formals(m_nodeAllocator);
         ParseNodePtr pnodeT = nullptr;
         bool seenRestParameter = false;
         bool isNonSimpleParameterList = false;
@@ -6357,7 +6363,7 @@ void Parser::CheckStrictFormalParameters()
 
     if (m_token.tk != tkRParen)
     {
-        SList<IdentPtr> formals(&m_nodeAllocator);
+        SList<IdentPtr> formals(m_nodeAllocator);
         for (;;)
         {
             if (m_token.tk != tkID)
@@ -6792,7 +6798,7 @@ ParseNodePtr Parser::ParseClassDecl(BOOL isDeclaration, LPCOLESTR pNameHint, uin
     uint32 nameHintLength = pHintLength ? *pHintLength : 0;
     uint32 nameHintOffset = pShortNameOffset ? *pShortNameOffset : 0;
 
-    ArenaAllocator tempAllocator(_u("ClassMemberNames"), m_nodeAllocator.GetPageAllocator(), Parser::OutOfMemory);
+    ArenaAllocator tempAllocator(_u("ClassMemberNames"), m_nodeAllocator->GetPageAllocator(), Parser::OutOfMemory);
 
     ParseNodePtr pnodeClass = nullptr;
     if (buildAST)
@@ -8465,7 +8471,7 @@ PidRefStack* Parser::PushPidRef(IdentPtr pid)
         // NOTE: the phase check is here to protect perf. See OSG 1020424.
         // In some LS AST-rewrite cases we lose a lot of perf searching the PID ref stack rather
         // than just pushing on the top. This hasn't shown up as a perf issue in non-LS benchmarks.
-        return pid->FindOrAddPidRef(&m_nodeAllocator, GetCurrentBlock()->sxBlock.blockId);
+        return pid->FindOrAddPidRef(m_nodeAllocator, GetCurrentBlock()->sxBlock.blockId);
     }
 
     Assert(GetCurrentBlock() != nullptr);
@@ -8473,7 +8479,7 @@ PidRefStack* Parser::PushPidRef(IdentPtr pid)
     PidRefStack *ref = pid->GetTopRef();
     if (!ref || (ref->GetScopeId() < GetCurrentBlock()->sxBlock.blockId))
     {
-        ref = Anew(&m_nodeAllocator, PidRefStack);
+        ref = Anew(m_nodeAllocator, PidRefStack);
         if (ref == nullptr)
         {
             Error(ERRnoMemory);
@@ -8486,7 +8492,7 @@ PidRefStack* Parser::PushPidRef(IdentPtr pid)
 
 PidRefStack* Parser::FindOrAddPidRef(IdentPtr pid, int scopeId)
 {
-    PidRefStack *ref = pid->FindOrAddPidRef(&m_nodeAllocator, scopeId);
+    PidRefStack *ref = pid->FindOrAddPidRef(m_nodeAllocator, scopeId);
     if (ref == NULL)
     {
         Error(ERRnoMemory);
@@ -8500,7 +8506,7 @@ void Parser::RemovePrevPidRef(IdentPtr pid, PidRefStack *ref)
     Assert(prevRef);
     if (prevRef->GetSym() == nullptr)
     {
-        AllocatorDelete(ArenaAllocator, &m_nodeAllocator, prevRef);
+        AllocatorDelete(ArenaAllocator, m_nodeAllocator, prevRef);
     }
 }
 
@@ -8913,7 +8919,7 @@ ParseNodePtr Parser::ParseCatch()
                 const char16 *name = reinterpret_cast<const char16*>(pidCatch->Psz());
                 int nameLength = pidCatch->Cch();
                 SymbolName const symName(name, nameLength);
-                Symbol *sym = Anew(&m_nodeAllocator, Symbol, symName, pnodeParam, STVariable);
+                Symbol *sym = Anew(m_nodeAllocator, Symbol, symName, pnodeParam, STVariable);
                 sym->SetPid(pidCatch);
                 if (sym == nullptr)
                 {
@@ -11033,7 +11039,7 @@ void Parser::AddFastScannedRegExpNode(ParseNodePtr const pnode)
 
     if (fastScannedRegExpNodes == nullptr)
     {
-        fastScannedRegExpNodes = Anew(&m_nodeAllocator, NodeDList, &m_nodeAllocator);
+        fastScannedRegExpNodes = Anew(m_nodeAllocator, NodeDList, m_nodeAllocator);
     }
     fastScannedRegExpNodes->Append(pnode);
 }
@@ -11044,7 +11050,7 @@ void Parser::AddBackgroundRegExpNode(ParseNodePtr const pnode)
     Assert(IsBackgroundParser());
     Assert(currBackgroundParseItem != nullptr);
 
-    currBackgroundParseItem->AddRegExpNode(pnode, &m_nodeAllocator);
+    currBackgroundParseItem->AddRegExpNode(pnode, m_nodeAllocator);
 }
 #endif
 
@@ -11227,7 +11233,7 @@ ParseNodePtr Parser::CreateNode(OpCode nop, charcount_t ichMin, charcount_t ichL
     __analysis_assume(nop < knopLim);
     int cb = nop >= 0 && nop < knopLim ? g_mpnopcbNode[nop] : kcbPnNone;
 
-    pnode = (ParseNodePtr)m_nodeAllocator.Alloc(cb);
+    pnode = (ParseNodePtr)m_nodeAllocator->Alloc(cb);
     Assert(pnode);
 
     Assert(m_pCurrentAstSize != NULL);
@@ -11254,7 +11260,7 @@ ParseNodePtr Parser::CreateUniNode(OpCode nop, ParseNodePtr pnode1, charcount_t
     Assert(!this->m_deferringAST);
     DebugOnly(VerifyNodeSize(nop, kcbPnUni));
 
-    ParseNodePtr pnode = (ParseNodePtr)m_nodeAllocator.Alloc(kcbPnUni);
+    ParseNodePtr pnode = (ParseNodePtr)m_nodeAllocator->Alloc(kcbPnUni);
 
     Assert(m_pCurrentAstSize != NULL);
     *m_pCurrentAstSize += kcbPnUni;
@@ -11273,7 +11279,7 @@ ParseNodePtr Parser::CreateBinNode(OpCode nop, ParseNodePtr pnode1,
                                    ParseNodePtr pnode2,charcount_t ichMin,charcount_t ichLim)
 {
     Assert(!this->m_deferringAST);
-    ParseNodePtr pnode = StaticCreateBinNode(nop, pnode1, pnode2, &m_nodeAllocator);
+    ParseNodePtr pnode = StaticCreateBinNode(nop, pnode1, pnode2, m_nodeAllocator);
 
     Assert(m_pCurrentAstSize != NULL);
     *m_pCurrentAstSize += kcbPnBin;
@@ -11290,7 +11296,7 @@ ParseNodePtr Parser::CreateTriNode(OpCode nop, ParseNodePtr pnode1,
 {
     Assert(!this->m_deferringAST);
     DebugOnly(VerifyNodeSize(nop, kcbPnTri));
-    ParseNodePtr pnode = (ParseNodePtr)m_nodeAllocator.Alloc(kcbPnTri);
+    ParseNodePtr pnode = (ParseNodePtr)m_nodeAllocator->Alloc(kcbPnTri);
 
     Assert(m_pCurrentAstSize != NULL);
     *m_pCurrentAstSize += kcbPnTri;
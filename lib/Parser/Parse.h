@@ -136,7 +136,7 @@ public:
     ParseNode* CopyPnode(ParseNode* pnode);
     IdentPtr GenerateIdentPtr(__ecount(len) char16* name,int32 len);
 
-    ArenaAllocator *GetAllocator() { return &m_nodeAllocator;}
+    ArenaAllocator *GetAllocator() { return m_nodeAllocator;}
 
     size_t GetSourceLength() { return m_length; }
     size_t GetOriginalSourceLength() { return m_originalLength; }
@@ -182,7 +182,8 @@ private:
     /***********************************************************************
     Core members.
     ***********************************************************************/
-    ParseNodeAllocator m_nodeAllocator;
+    ParseNodeAllocator * m_nodeAllocator;
+    ParseNodeAllocator m_localNodeAllocator;    // Used when the parser has its own page allocator
     int32        m_cactIdentToNodeLookup;
     uint32       m_grfscr;
     size_t      m_length;             // source length in characters excluding comments and literals
@@ -213,7 +214,10 @@ protected:
 private:
     __declspec(noreturn) void Error(HRESULT hr, ParseNodePtr pnode);
     __declspec(noreturn) void Error(HRESULT hr, charcount_t ichMin, charcount_t ichLim);
+public:
+    // Also the out of memory handler of the thread context's pooled parser arenas
     __declspec(noreturn) static void OutOfMemory();
+private:
 
     void GenerateCode(ParseNodePtr pnode, void *pvUser, int32 cbUser,
         LPCOLESTR pszSrc, int32 cchSrc, LPCOLESTR pszTitle);
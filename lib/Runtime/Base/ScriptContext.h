@@ -723,12 +723,15 @@ private:
         ScriptConfiguration config;
         CharClassifier *charClassifier;
 
+#if ENABLE_BACKGROUND_PARSING
+        BackgroundParser *backgroundParser;
+#endif
+
         // DisableJIT-TODO: Switch this to Dynamic thunk ifdef instead
 #if ENABLE_NATIVE_CODEGEN
 #if DYNAMIC_INTERPRETER_THUNK
         InterpreterThunkEmitter* interpreterThunkEmitter;
 #endif
-        BackgroundParser *backgroundParser;
 #ifdef ASMJS_PLAT
         InterpreterThunkEmitter* asmJsInterpreterThunkEmitter;
         AsmJsCodeGenerator* asmJsCodeGenerator;
@@ -122,7 +122,7 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     recycler(nullptr),
     hasCollectionCallBack(false),
     callDispose(true),
-#if ENABLE_NATIVE_CODEGEN
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
     jobProcessor(nullptr),
 #endif
     interruptPoller(nullptr),
@@ -138,6 +138,8 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     threadServiceWrapper(nullptr),
     temporaryArenaAllocatorCount(0),
     temporaryGuestArenaAllocatorCount(0),
+    parserArenaPool(_u("Parser"), Parser::OutOfMemory),
+    byteCodeArenaPool(_u("ByteCode"), Js::Throw::OutOfMemory),
     crefSContextForDiag(0),
     scriptContextList(nullptr),
     scriptContextEverRegistered(false),
@@ -355,6 +357,9 @@ ThreadContext::~ThreadContext()
     pageAllocator.ShutdownIdleDecommit();
 #endif
 
+    parserArenaPool.Clear();
+    byteCodeArenaPool.Clear();
+
     // Allocating memory during the shutdown codepath is not preferred
     // so we'll close the page allocator before we release the GC
     // If any dispose is allocating memory during shutdown, that is a bug
@@ -431,7 +436,7 @@ ThreadContext::~ThreadContext()
         HeapDelete(recycler);
     }
 
-#if ENABLE_NATIVE_CODEGEN
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
     if(jobProcessor)
     {
         if(this->bgJit)
@@ -1206,7 +1211,7 @@ ThreadContext::ForceCleanPropertyMap()
     // No-op now that we no longer use weak refs
 }
 
-#if ENABLE_NATIVE_CODEGEN
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
 JsUtil::JobProcessor *
 ThreadContext::GetJobProcessor()
 {
@@ -1753,6 +1758,25 @@ ThreadContext::PopInterpreterFrame()
     return interpreterFrame;
 }
 
+// The recycler's stack scan leaves the interpreter frames to us, see Recycler::ScanStackWithPreciseFrames
+void *
+ThreadContext::GetNextPreciseStackFrame(void * frame, size_t * frameBytes)
+{
+    Js::InterpreterStackFrame * interpreterFrame = (frame == nullptr) ?
+        this->leafInterpreterFrame : ((Js::InterpreterStackFrame *)frame)->GetPreviousFrame();
+    if (interpreterFrame != nullptr)
+    {
+        *frameBytes = interpreterFrame->GetPreciseRootsFrameBytes();
+    }
+    return interpreterFrame;
+}
+
+size_t
+ThreadContext::ScanPreciseStackFrame(void * frame, RecyclerScanMemoryCallback& scanMemoryCallback)
+{
+    return ((Js::InterpreterStackFrame *)frame)->ScanPreciseRoots(scanMemoryCallback);
+}
+
 BOOL
 ThreadContext::ExecuteRecyclerCollectionFunctionCommon(Recycler * recycler, CollectionFunction function, CollectionFlags flags)
 {
@@ -2055,6 +2079,70 @@ ThreadContext::ReleaseTemporaryGuestAllocator(Js::TempGuestArenaAllocatorObject
     tempGuestAllocator->Dispose(false);
 }
 
+ThreadContext::CompileArenaPool::CompileArenaPool(LPCWSTR name, void (*outOfMemoryFunc)()) :
+    name(name),
+    outOfMemoryFunc(outOfMemoryFunc),
+    arenaCount(0),
+    highWaterMark(0),
+    peakSinceCollect(0)
+{
+}
+
+ArenaAllocator *
+ThreadContext::CompileArenaPool::Get(PageAllocator * pageAllocator)
+{
+    if (arenaCount != 0)
+    {
+        arenaCount--;
+        ArenaAllocator * arena = arenas[arenaCount];
+        arenas[arenaCount] = nullptr;
+        return arena;
+    }
+
+    return HeapNew(ArenaAllocator, name, pageAllocator, outOfMemoryFunc);
+}
+
+void
+ThreadContext::CompileArenaPool::Release(ArenaAllocator * arena)
+{
+    size_t maxRetainedBytes = (size_t)Js::Configuration::Global.flags.CompileArenaRetainedBytes;
+    if (arenaCount < MaxArenaCount && maxRetainedBytes != 0)
+    {
+        peakSinceCollect = max(peakSinceCollect, arena->AllocatedSize());
+        arena->ResetRetainingPages(min(max(highWaterMark, peakSinceCollect), maxRetainedBytes));
+        arenas[arenaCount] = arena;
+        arenaCount++;
+        return;
+    }
+
+    HeapDelete(arena);
+}
+
+void
+ThreadContext::CompileArenaPool::Trim()
+{
+    // Start a new period; arenas keep what the compiles of the period that just ended needed
+    highWaterMark = peakSinceCollect;
+    peakSinceCollect = 0;
+
+    size_t maxRetainedBytes = min(highWaterMark, (size_t)Js::Configuration::Global.flags.CompileArenaRetainedBytes);
+    for (uint i = 0; i < arenaCount; i++)
+    {
+        arenas[i]->ResetRetainingPages(maxRetainedBytes);
+    }
+}
+
+void
+ThreadContext::CompileArenaPool::Clear()
+{
+    while (arenaCount != 0)
+    {
+        arenaCount--;
+        HeapDelete(arenas[arenaCount]);
+        arenas[arenaCount] = nullptr;
+    }
+}
+
 void
 ThreadContext::AddToPendingScriptContextCloseList(Js::ScriptContext * scriptContext)
 {
@@ -2298,6 +2386,9 @@ ThreadContext::PostCollectionCallBack()
 
     TryExitExpirableCollectMode();
 
+    parserArenaPool.Trim();
+    byteCodeArenaPool.Trim();
+
     // Recycler is null in the case where the ThreadContext is in the process of creating the recycler and
     // we have a GC triggered (say because the -recyclerStress flag is passed in)
     if (this->recycler != NULL && this->recycler->InCacheCleanupCollection())
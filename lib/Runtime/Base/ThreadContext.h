@@ -664,8 +664,10 @@ private:
 #endif
 #endif
 
-#if ENABLE_NATIVE_CODEGEN
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
     JsUtil::JobProcessor *jobProcessor;
+#endif
+#if ENABLE_NATIVE_CODEGEN
     Js::Var * bailOutRegisterSaveSpace;
     CodeGenNumberThreadAllocator * codeGenNumberThreadAllocator;
     PreReservedVirtualAllocWrapper preReservedVirtualAllocator;
@@ -679,6 +681,30 @@ private:
     uint temporaryArenaAllocatorCount;
     uint temporaryGuestArenaAllocatorCount;
 
+    // Arenas for parsing and byte code generation. A released arena keeps as many emptied pages as the
+    // biggest compile since the last collection needed, up to -CompileArenaRetainedBytes, so that the
+    // next compile doesn't go back to the page allocator; each collection trims the pool to that mark.
+    class CompileArenaPool
+    {
+    public:
+        CompileArenaPool(LPCWSTR name, void (*outOfMemoryFunc)());
+        ArenaAllocator * Get(PageAllocator * pageAllocator);
+        void Release(ArenaAllocator * arena);
+        void Trim();
+        void Clear();
+    private:
+        static uint const MaxArenaCount = 4;
+
+        LPCWSTR name;
+        void (*outOfMemoryFunc)();
+        ArenaAllocator * arenas[MaxArenaCount];
+        uint arenaCount;
+        size_t highWaterMark;           // Most bytes a compile used before the last collection
+        size_t peakSinceCollect;        // Most bytes a compile used since the last collection
+    };
+    CompileArenaPool parserArenaPool;
+    CompileArenaPool byteCodeArenaPool;
+
 #if DBG_DUMP || defined(PROFILE_EXEC)
     ScriptSite* topLevelScriptSite;
 #endif
@@ -1004,7 +1030,7 @@ public:
 
     void ShutdownThreads()
     {
-#if ENABLE_NATIVE_CODEGEN
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
         if (jobProcessor)
         {
             jobProcessor->Close();
@@ -1148,9 +1174,11 @@ public:
     Js::ScriptEntryExitRecord * GetScriptEntryExit() const { return entryExitRecord; }
     void RegisterCodeGenRecyclableData(Js::CodeGenRecyclableData *const codeGenRecyclableData);
     void UnregisterCodeGenRecyclableData(Js::CodeGenRecyclableData *const codeGenRecyclableData);
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
+    JsUtil::JobProcessor *GetJobProcessor();
+#endif
 #if ENABLE_NATIVE_CODEGEN
     BOOL IsNativeAddress(void * pCodeAddr);
-    JsUtil::JobProcessor *GetJobProcessor();
     Js::Var * GetBailOutRegisterSaveSpace() const { return bailOutRegisterSaveSpace; }
     CodeGenNumberThreadAllocator * GetCodeGenNumberThreadAllocator() const
     {
@@ -1179,6 +1207,11 @@ public:
     Js::TempGuestArenaAllocatorObject * GetTemporaryGuestAllocator(LPCWSTR name);
     void ReleaseTemporaryGuestAllocator(Js::TempGuestArenaAllocatorObject * tempAllocator);
 
+    ArenaAllocator * GetParserArena() { return parserArenaPool.Get(&pageAllocator); }
+    void ReleaseParserArena(ArenaAllocator * arena) { parserArenaPool.Release(arena); }
+    ArenaAllocator * GetByteCodeArena() { return byteCodeArenaPool.Get(&pageAllocator); }
+    void ReleaseByteCodeArena(ArenaAllocator * arena) { byteCodeArenaPool.Release(arena); }
+
     // Should be called from script context, at the time when construction for scriptcontext is just done.
     void EnsureDebugManager();
 
@@ -1495,6 +1528,8 @@ public:
     virtual void DisposeScriptContextByFaultInjectionCallBack() override;
 #endif
     virtual void DisposeObjects(Recycler * recycler) override;
+    virtual void * GetNextPreciseStackFrame(void * frame, size_t * frameBytes) override;
+    virtual size_t ScanPreciseStackFrame(void * frame, RecyclerScanMemoryCallback& scanMemoryCallback) override;
 
     typedef DList<ExpirableObject*, ArenaAllocator> ExpirableObjectList;
     ExpirableObjectList* expirableObjectList;
@@ -1563,7 +1598,7 @@ public:
 
     }
 
-#if ENABLE_NATIVE_CODEGEN
+#if ENABLE_BACKGROUND_JOB_PROCESSOR
     bool IsBgJitEnabled() const { return bgJit; }
 
     void EnableBgJit(const bool enableBgJit)
@@ -1819,6 +1819,19 @@ bool ByteCodeGenerator::DoJitLoopBodies(FuncInfo *funcInfo) const
     return functionBody->ForceJITLoopBody() || funcInfo->byteCodeFunction->IsJitLoopBodyPhaseEnabled();
 }
 
+// Borrows an arena from the thread context's pool and gives it back however the byte code generation ends
+class AutoByteCodeArena
+{
+public:
+    AutoByteCodeArena(ThreadContext * threadContext) : threadContext(threadContext), arena(threadContext->GetByteCodeArena()) {}
+    ~AutoByteCodeArena() { threadContext->ReleaseByteCodeArena(arena); }
+    ArenaAllocator * GetAllocator() const { return arena; }
+
+private:
+    ThreadContext * threadContext;
+    ArenaAllocator * arena;
+};
+
 void ByteCodeGenerator::Generate(__in ParseNode *pnode, uint32 grfscr, __in ByteCodeGenerator* byteCodeGenerator,
     __inout Js::ParseableFunctionInfo ** ppRootFunc, __in uint sourceIndex,
     __in bool forceNoNative, __in Parser* parser, Js::ScriptFunction **functionRef)
@@ -1840,10 +1853,10 @@ void ByteCodeGenerator::Generate(__in ParseNode *pnode, uint32 grfscr, __in Byte
     utf8SourceInfo->EnsureInitialized((grfscr & fscrDynamicCode) ? 4 : (sourceContextInfo->nextLocalFunctionId - pnode->sxFnc.functionId));
     sourceContextInfo->EnsureInitialized();
 
-    ArenaAllocator localAlloc(_u("ByteCode"), threadContext->GetPageAllocator(), Js::Throw::OutOfMemory);
+    AutoByteCodeArena localAlloc(threadContext);
     byteCodeGenerator->parser = parser;
     byteCodeGenerator->SetCurrentSourceIndex(sourceIndex);
-    byteCodeGenerator->Begin(&localAlloc, grfscr, *ppRootFunc);
+    byteCodeGenerator->Begin(localAlloc.GetAllocator(), grfscr, *ppRootFunc);
     byteCodeGenerator->functionRef = functionRef;
     Visit(pnode, byteCodeGenerator, Bind, AssignRegisters);
 
@@ -25,6 +25,38 @@
 #define INTERPRETERPROFILE 0
 #define PROFILEDOP(prof, unprof) unprof
 #endif
+// Threaded dispatch jumps straight from the dispatch table to the case for each opcode
+// instead of going through the switch's bounds check and jump table. The compiler
+// duplicates the indirect jump into the handlers, so each handler predicts its own
+// successor. The debugger loop can rewrite op before dispatch, so it keeps the switch.
+#if ENABLE_INTERPRETER_THREADED_DISPATCH && !DEBUGGING_LOOP && !(defined(INTERPRETER_ASMJS) && !defined(TEMP_DISABLE_ASMJS))
+#define THREADED_DISPATCH 1
+#define THREADED_DISPATCH_LABEL(name) ThreadedDispatch_##name:
+// Every handler ends with its own copy of the indirect jump, so each one is predicted
+// from the history of the opcode that precedes it.
+#define THREADED_DISPATCH_NEXT() \
+    do \
+    { \
+        op = ReadByteOp<INTERPRETER_OPCODE>(ip); \
+        INTERPRETER_OPCODE_TELEMETRY(); \
+        goto *threadedDispatchTable[(uint)op]; \
+    } while (false)
+#else
+#define THREADED_DISPATCH 0
+#define THREADED_DISPATCH_LABEL(name)
+#define THREADED_DISPATCH_NEXT() break
+#endif
+#ifdef ENABLE_BASIC_TELEMETRY
+#define INTERPRETER_OPCODE_TELEMETRY() \
+    if (TELEMETRY_OPCODE_OFFSET_ENABLED) \
+    { \
+        OpcodeTelemetry& opcodeTelemetry = this->scriptContext->GetTelemetry().GetOpcodeTelemetry(); \
+        opcodeTelemetry.ProgramLocationFunctionId    ( this->function->GetFunctionInfo()->GetLocalFunctionId() ); \
+        opcodeTelemetry.ProgramLocationBytecodeOffset( this->m_reader.GetCurrentOffset() ); \
+    }
+#else
+#define INTERPRETER_OPCODE_TELEMETRY()
+#endif
 #if defined (DBG)
 // Win8 516184: Huge switch with lots of labels each having a few locals on ARM.DBG causes each occurrence
 // of this function (call of a javascript function in interpreter mode) to take 7+KB stack space
@@ -58,18 +90,42 @@ Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
     // For checked builds this does mean we are incrementing 2 different counters to
     // track the ip.
     const byte* ip = m_reader.GetIP();
-    while (true)
+#if THREADED_DISPATCH
+    // Labels can't be named outside this function, so the table is filled on first use.
+    // Racing threads all store the same addresses.
+    static void * threadedDispatchTable[(uint)INTERPRETER_OPCODE::MaxByteSizedOpcodes + 1];
+    static bool threadedDispatchTableInitialized = false;
+    if (!threadedDispatchTableInitialized)
     {
-        INTERPRETER_OPCODE op = ReadByteOp<INTERPRETER_OPCODE>(ip);
-
-#ifdef ENABLE_BASIC_TELEMETRY
-        if( TELEMETRY_OPCODE_OFFSET_ENABLED )
+        for (uint i = 0; i <= (uint)INTERPRETER_OPCODE::MaxByteSizedOpcodes; i++)
         {
-            OpcodeTelemetry& opcodeTelemetry = this->scriptContext->GetTelemetry().GetOpcodeTelemetry();
-            opcodeTelemetry.ProgramLocationFunctionId    ( this->function->GetFunctionInfo()->GetLocalFunctionId() );
-            opcodeTelemetry.ProgramLocationBytecodeOffset( this->m_reader.GetCurrentOffset() );
+            threadedDispatchTable[i] = &&ThreadedDispatch_Default;
         }
+        threadedDispatchTable[(uint)INTERPRETER_OPCODE::Ret] = &&ThreadedDispatch_Ret;
+        threadedDispatchTable[(uint)INTERPRETER_OPCODE::Yield] = &&ThreadedDispatch_Yield;
+        threadedDispatchTable[(uint)INTERPRETER_OPCODE::Leave] = &&ThreadedDispatch_Leave;
+        threadedDispatchTable[(uint)INTERPRETER_OPCODE::LeaveNull] = &&ThreadedDispatch_LeaveNull;
+        threadedDispatchTable[(uint)INTERPRETER_OPCODE::ExtendedOpcodePrefix] = &&ThreadedDispatch_ExtendedOpcodePrefix;
+        threadedDispatchTable[(uint)INTERPRETER_OPCODE::MediumLayoutPrefix] = &&ThreadedDispatch_MediumLayoutPrefix;
+        threadedDispatchTable[(uint)INTERPRETER_OPCODE::ExtendedMediumLayoutPrefix] = &&ThreadedDispatch_ExtendedMediumLayoutPrefix;
+        threadedDispatchTable[(uint)INTERPRETER_OPCODE::LargeLayoutPrefix] = &&ThreadedDispatch_LargeLayoutPrefix;
+        threadedDispatchTable[(uint)INTERPRETER_OPCODE::ExtendedLargeLayoutPrefix] = &&ThreadedDispatch_ExtendedLargeLayoutPrefix;
+        threadedDispatchTable[(uint)INTERPRETER_OPCODE::EndOfBlock] = &&ThreadedDispatch_EndOfBlock;
+        threadedDispatchTable[(uint)INTERPRETER_OPCODE::Break] = &&ThreadedDispatch_Break;
+#define DEF2(x, op, ...) threadedDispatchTable[(uint)INTERPRETER_OPCODE::op] = &&ThreadedDispatch_##op;
+#define DEF3(x, op, ...) threadedDispatchTable[(uint)INTERPRETER_OPCODE::op] = &&ThreadedDispatch_##op;
+#define DEF2_WMS(x, op, ...) threadedDispatchTable[(uint)INTERPRETER_OPCODE::op] = &&ThreadedDispatch_##op;
+#define DEF3_WMS(x, op, ...) threadedDispatchTable[(uint)INTERPRETER_OPCODE::op] = &&ThreadedDispatch_##op;
+#define DEF4_WMS(x, op, ...) threadedDispatchTable[(uint)INTERPRETER_OPCODE::op] = &&ThreadedDispatch_##op;
+#include "InterpreterHandler.inl"
+        MemoryBarrier();
+        threadedDispatchTableInitialized = true;
+    }
 #endif
+    while (true)
+    {
+        INTERPRETER_OPCODE op = ReadByteOp<INTERPRETER_OPCODE>(ip);
+        INTERPRETER_OPCODE_TELEMETRY();
 
 #if DEBUGGING_LOOP
         if (this->scriptContext->GetThreadContext()->GetDebugManager()->stepController.IsActive() &&
@@ -110,10 +166,13 @@ Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
             }
         }
 SWAP_BP_FOR_OPCODE:
+#endif
+#if THREADED_DISPATCH
+        goto *threadedDispatchTable[(uint)op];
 #endif
         switch (op)
         {
-        case INTERPRETER_OPCODE::Ret:
+        case INTERPRETER_OPCODE::Ret: THREADED_DISPATCH_LABEL(Ret)
             {
                 //
                 // Return "Reg: 0" as the return-value.
@@ -129,7 +188,7 @@ SWAP_BP_FOR_OPCODE:
                 return GetReg((RegSlot)0);
             }
 
-        case INTERPRETER_OPCODE::Yield:
+        case INTERPRETER_OPCODE::Yield: THREADED_DISPATCH_LABEL(Yield)
             {
                 m_reader.Reg2_Small(ip);
                 return GetReg(GetFunctionBody()->GetYieldRegister());
@@ -141,22 +200,32 @@ SWAP_BP_FOR_OPCODE:
 #define DEF3_WMS(x, op, func, y) PROCESS_##x##_COMMON(op, func, y, _Small)
 #define DEF4_WMS(x, op, func, y, t) PROCESS_##x##_COMMON(op, func, y, _Small, t)
 
+#undef PROCESS_OPCODE_LABEL
+#undef PROCESS_OPCODE_NEXT
+#define PROCESS_OPCODE_LABEL(name) THREADED_DISPATCH_LABEL(name)
+#define PROCESS_OPCODE_NEXT() THREADED_DISPATCH_NEXT()
 #include "InterpreterHandler.inl"
+// The prefix handlers below switch inside lambdas, so their cases are never jump targets
+// and must break out of their own switch
+#undef PROCESS_OPCODE_LABEL
+#undef PROCESS_OPCODE_NEXT
+#define PROCESS_OPCODE_LABEL(name)
+#define PROCESS_OPCODE_NEXT() break
 
-            case INTERPRETER_OPCODE::Leave:
+            case INTERPRETER_OPCODE::Leave: THREADED_DISPATCH_LABEL(Leave)
                 // Return the continuation address to the helper.
                 // This tells the helper that control left the scope without completing the try/handler,
                 // which is particularly significant when executing a finally.
                 m_reader.Empty(ip);
                 return (Var)this->m_reader.GetCurrentOffset();
-            case INTERPRETER_OPCODE::LeaveNull:
+            case INTERPRETER_OPCODE::LeaveNull: THREADED_DISPATCH_LABEL(LeaveNull)
                 // Return to the helper without specifying a continuation address,
                 // indicating that the handler completed without jumping, so exception processing
                 // should continue.
                 m_reader.Empty(ip);
                 return nullptr;
 
-            case INTERPRETER_OPCODE::ExtendedOpcodePrefix:
+            case INTERPRETER_OPCODE::ExtendedOpcodePrefix: THREADED_DISPATCH_LABEL(ExtendedOpcodePrefix)
             {
                 ip = [this](const byte * ip) -> const byte *
                 {
@@ -189,9 +258,9 @@ SWAP_BP_FOR_OPCODE:
                     return nullptr;
                 }
 #endif
-                break;
+                THREADED_DISPATCH_NEXT();
             }
-            case INTERPRETER_OPCODE::MediumLayoutPrefix:
+            case INTERPRETER_OPCODE::MediumLayoutPrefix: THREADED_DISPATCH_LABEL(MediumLayoutPrefix)
             {
                 Var yieldValue = nullptr;
                 ip = [this, &yieldValue](const byte * ip) -> const byte *
@@ -229,9 +298,9 @@ SWAP_BP_FOR_OPCODE:
                     return nullptr;
                 }
 #endif
-                break;
+                THREADED_DISPATCH_NEXT();
             }
-            case INTERPRETER_OPCODE::ExtendedMediumLayoutPrefix:
+            case INTERPRETER_OPCODE::ExtendedMediumLayoutPrefix: THREADED_DISPATCH_LABEL(ExtendedMediumLayoutPrefix)
             {
                 ip = [this](const byte * ip) -> const byte *
                 {
@@ -262,9 +331,9 @@ SWAP_BP_FOR_OPCODE:
                     return nullptr;
                 }
 #endif
-                break;
+                THREADED_DISPATCH_NEXT();
             }
-            case INTERPRETER_OPCODE::LargeLayoutPrefix:
+            case INTERPRETER_OPCODE::LargeLayoutPrefix: THREADED_DISPATCH_LABEL(LargeLayoutPrefix)
             {
                 Var yieldValue = nullptr;
 
@@ -303,9 +372,9 @@ SWAP_BP_FOR_OPCODE:
                     return nullptr;
                 }
 #endif
-                break;
+                THREADED_DISPATCH_NEXT();
             }
-            case INTERPRETER_OPCODE::ExtendedLargeLayoutPrefix:
+            case INTERPRETER_OPCODE::ExtendedLargeLayoutPrefix: THREADED_DISPATCH_LABEL(ExtendedLargeLayoutPrefix)
             {
                 ip = [this](const byte * ip) -> const byte *
                 {
@@ -336,10 +405,10 @@ SWAP_BP_FOR_OPCODE:
                     return nullptr;
                 }
 #endif
-                break;
+                THREADED_DISPATCH_NEXT();
             }
 
-            case INTERPRETER_OPCODE::EndOfBlock:
+            case INTERPRETER_OPCODE::EndOfBlock: THREADED_DISPATCH_LABEL(EndOfBlock)
             {
                 // Note that at this time though ip was advanced by 'OpCode op = ReadByteOp<INTERPRETER_OPCODE>(ip)',
                 // we haven't advanced m_reader.m_currentLocation yet, thus m_reader.m_currentLocation still points to EndOfBLock,
@@ -364,7 +433,7 @@ SWAP_BP_FOR_OPCODE:
 #endif
             }
 
-            case INTERPRETER_OPCODE::Break:
+            case INTERPRETER_OPCODE::Break: THREADED_DISPATCH_LABEL(Break)
             {
 #if DEBUGGING_LOOP
                 // The reader has already advanced the IP:
@@ -405,9 +474,9 @@ SWAP_BP_FOR_OPCODE:
 #else
                 m_reader.Empty(ip);
 #endif
-                break;
+                THREADED_DISPATCH_NEXT();
             }
-            default:
+            default: THREADED_DISPATCH_LABEL(Default)
                 // Help the C++ optimizer by declaring that the cases we
                 // have above are sufficient
                 AssertMsg(false, "dispatch to bad opcode");
@@ -419,6 +488,10 @@ SWAP_BP_FOR_OPCODE:
 // Restore optimizations to what's specified by the /O switch.
 #pragma optimize("", on)
 #endif
+#undef INTERPRETER_OPCODE_TELEMETRY
+#undef THREADED_DISPATCH_NEXT
+#undef THREADED_DISPATCH_LABEL
+#undef THREADED_DISPATCH
 #undef DEBUGGING_LOOP
 #undef INTERPRETERPROFILE
 #undef PROFILEDOP
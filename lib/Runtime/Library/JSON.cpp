@@ -318,15 +318,22 @@ namespace JSON
 
         BEGIN_TEMP_ALLOCATOR(tempAlloc, scriptContext, _u("JSON"))
         {
-            stringifySession.CompleteInit(space, tempAlloc);
+            TryFinally([&]()
+            {
+                stringifySession.CompleteInit(space, tempAlloc);
 
-            Js::DynamicObject* wrapper = scriptContext->GetLibrary()->CreateObject();
-            JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_OBJECT(wrapper));
-            Js::PropertyRecord const * propertyRecord;
-            scriptContext->GetOrAddPropertyRecord(_u(""), 0, &propertyRecord);
-            Js::PropertyId propertyId = propertyRecord->GetPropertyId();
-            Js::JavascriptOperators::InitProperty(wrapper, propertyId, value);
-            result = stringifySession.Str(scriptContext->GetLibrary()->GetEmptyString(), propertyId, wrapper);
+                Js::DynamicObject* wrapper = scriptContext->GetLibrary()->CreateObject();
+                JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_OBJECT(wrapper));
+                Js::PropertyRecord const * propertyRecord;
+                scriptContext->GetOrAddPropertyRecord(_u(""), 0, &propertyRecord);
+                Js::PropertyId propertyId = propertyRecord->GetPropertyId();
+                Js::JavascriptOperators::InitProperty(wrapper, propertyId, value);
+                result = stringifySession.Str(scriptContext->GetLibrary()->GetEmptyString(), propertyId, wrapper);
+            },
+            [&](bool/*hasException*/)
+            {
+                stringifySession.Finalizer();
+            });
         }
         END_TEMP_ALLOCATOR(tempAlloc, scriptContext);
 
@@ -388,6 +395,16 @@ namespace JSON
         objectStack = Anew(tempAlloc, JSONStack, tempAlloc, scriptContext);
     }
 
+    void StringifySession::Finalizer()
+    {
+        if (this->arenaAllocatorObject)
+        {
+            this->scriptContext->ReleaseTemporaryGuestAllocator(this->arenaAllocatorObject);
+            this->arenaAllocatorObject = nullptr;
+            this->typeCacheList = nullptr;
+        }
+    }
+
     Js::Var StringifySession::Str(uint32 index, Js::Var holder)
     {
         Js::Var value;
@@ -586,6 +603,7 @@ namespace JSON
         Js::RecyclableObject* object = Js::RecyclableObject::FromVar(value);
         Js::JavascriptString* result = NULL;
 
+        JsonStringifyTypeCache* typeCache = nullptr;
         if(ReplacerArray == this->replacerType)
         {
             result = Js::ConcatStringBuilder::New(this->scriptContext, this->replacer.propertyList.length); // Reserve initial slots for properties.
@@ -598,6 +616,10 @@ namespace JSON
                 StringifyMemberObject(propertyName, id, value, (Js::ConcatStringBuilder*)result, indentString, memberSeparator, isFirstMember,  isEmpty);
             }
         }
+        else if (ReplacerNone == this->replacerType && (typeCache = GetTypeCache(object)) != nullptr)
+        {
+            result = StringifyObjectWithTypeCache(Js::DynamicObject::FromVar(object), typeCache, indentString, memberSeparator, isEmpty);
+        }
         else
         {
             if (JavascriptProxy::Is(object))
@@ -767,6 +789,124 @@ namespace JSON
         return result;
     }
 
+    JsonStringifyTypeCache* StringifySession::GetTypeCache(Js::RecyclableObject* object)
+    {
+        // Only plain objects whose type is shared (so its PathTypeHandler can no longer change in place) qualify.
+        // PathTypeHandler properties are always enumerable data properties; accessors, non-enumerable properties
+        // and indexed properties either move the object to a different handler or live in the object array.
+        if (!VirtualTableInfo<Js::DynamicObject>::HasVirtualTable(object))
+        {
+            return nullptr;
+        }
+
+        Js::DynamicObject* dynamicObject = Js::DynamicObject::FromVar(object);
+        Js::DynamicType* type = dynamicObject->GetDynamicType();
+        if (!type->GetIsShared() || !type->GetTypeHandler()->IsPathTypeHandler() || dynamicObject->HasObjectArray())
+        {
+            return nullptr;
+        }
+
+        JsonStringifyTypeCache* typeCache = nullptr;
+        if (this->typeCacheList && this->typeCacheList->TryGetValue(type, &typeCache))
+        {
+            return typeCache;
+        }
+
+        Js::DynamicType** recentUncachedType = &this->recentUncachedTypes[(reinterpret_cast<size_t>(type) >> 4) % RecentUncachedTypeCount];
+        if (*recentUncachedType != type)
+        {
+            // Don't pay for building the cache for a type that is only seen once
+            *recentUncachedType = type;
+            return nullptr;
+        }
+
+        if (!this->arenaAllocatorObject)
+        {
+            this->arenaAllocatorObject = scriptContext->GetTemporaryGuestAllocator(_u("JSONStringify"));
+        }
+        ArenaAllocator* arenaAllocator = this->arenaAllocatorObject->GetAllocator();
+        if (!this->typeCacheList)
+        {
+            this->typeCacheList = Anew(arenaAllocator, JsonStringifyTypeCacheList, arenaAllocator, 8);
+        }
+
+        Js::DynamicTypeHandler* typeHandler = type->GetTypeHandler();
+        int propertyCount = typeHandler->GetPropertyCount();
+
+        typeCache = AnewStruct(arenaAllocator, JsonStringifyTypeCache);
+        typeCache->type = type;
+        typeCache->memberCount = 0;
+        typeCache->members = AnewArray(arenaAllocator, JsonStringifyTypeCache::Member, propertyCount);
+
+        // Same order as the enumerator: slot order, skipping symbols
+        for (int i = 0; i < propertyCount; i++)
+        {
+            Js::PropertyIndex slotIndex = (Js::PropertyIndex)i;
+            Js::PropertyId propertyId = typeHandler->GetPropertyId(scriptContext, slotIndex);
+            if (scriptContext->GetPropertyName(propertyId)->IsSymbol())
+            {
+                continue;
+            }
+
+            Js::JavascriptString* propertyName = scriptContext->GetPropertyString(propertyId);
+            Js::JavascriptString* memberPrefix = Js::JavascriptString::Concat(Quote(propertyName), GetPropertySeparator());
+            memberPrefix->GetSz(); // flatten once, it is shared by every object of this type
+
+            JsonStringifyTypeCache::Member& member = typeCache->members[typeCache->memberCount++];
+            member.propertyName = propertyName;
+            member.memberPrefix = memberPrefix;
+            member.propertyId = propertyId;
+            member.slotIndex = slotIndex;
+        }
+
+        this->typeCacheList->Add(type, typeCache);
+        *recentUncachedType = nullptr;
+        return typeCache;
+    }
+
+    Js::JavascriptString* StringifySession::StringifyObjectWithTypeCache(Js::DynamicObject* object, JsonStringifyTypeCache* typeCache,
+        Js::JavascriptString* &indentString, Js::JavascriptString* &memberSeparator, bool &isEmpty)
+    {
+        Js::ConcatStringBuilder* result = Js::ConcatStringBuilder::New(this->scriptContext, typeCache->memberCount * 3); // separator, "name":, value
+
+        for (uint k = 0; k < typeCache->memberCount; k++)
+        {
+            const JsonStringifyTypeCache::Member& member = typeCache->members[k];
+
+            Js::Var propertyObjectString;
+            if (object->GetDynamicType() == typeCache->type)
+            {
+                propertyObjectString = StrHelper(member.propertyName, object->GetSlot(member.slotIndex), object);
+            }
+            else
+            {
+                // A toJSON or getter reached while serializing an earlier member changed the object's type.
+                // Keep the names we started with, as the enumerator snapshot would, but look the values up.
+                propertyObjectString = Str(member.propertyName, member.propertyId, object);
+            }
+
+            if (Js::JavascriptOperators::IsUndefinedObject(propertyObjectString, scriptContext))
+            {
+                continue;
+            }
+
+            if (!isEmpty)
+            {
+                if (!memberSeparator)
+                {
+                    indentString = GetIndentString(this->indent);
+                    memberSeparator = GetMemberSeparator(indentString);
+                }
+                result->Append(memberSeparator);
+            }
+            result->Append(member.memberPrefix);
+            result->Append(Js::JavascriptString::FromVar(propertyObjectString));
+            isEmpty = false;
+        }
+
+        return result;
+    }
+
     Js::JavascriptString* StringifySession::GetArrayElementString(uint32 index, Js::Var arrayVar)
     {
         Js::RecyclableObject *undefined = scriptContext->GetLibrary()->GetUndefined();
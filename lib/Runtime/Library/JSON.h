@@ -19,6 +19,23 @@ namespace JSON
     Js::Var Stringify(Js::RecyclableObject* function, Js::CallInfo callInfo, ...);
     Js::Var Parse(Js::RecyclableObject* function, Js::CallInfo callInfo, ...);
 
+    // Pre-computed member layout for objects of one PathTypeHandler type, used by StringifySession to
+    // serialize same-shaped objects by reading slots directly instead of enumerating them.
+    struct JsonStringifyTypeCache
+    {
+        struct Member
+        {
+            Js::JavascriptString* propertyName;
+            Js::JavascriptString* memberPrefix;     // quoted property name followed by the property separator
+            Js::PropertyId propertyId;
+            Js::PropertyIndex slotIndex;
+        };
+
+        Js::DynamicType* type;
+        uint memberCount;
+        Member* members;
+    };
+
     class StringifySession
     {
     public:
@@ -39,10 +56,13 @@ namespace JSON
                 replacerType(ReplacerNone),
                 gap(NULL),
                 indent(0),
-                propertySeparator(NULL)
+                propertySeparator(NULL),
+                arenaAllocatorObject(nullptr),
+                typeCacheList(nullptr)
         {
             replacer.propertyList.propertyNames = NULL;
             replacer.propertyList.length = 0;
+            memset(recentUncachedTypes, 0, sizeof(recentUncachedTypes));
         };
 
         Js::Var Stringify(){};
@@ -60,6 +80,7 @@ namespace JSON
             replacer.propertyList.length = len;
         }
         void CompleteInit(Js::Var space, ArenaAllocator* alloc);
+        void Finalizer();
 
         Js::Var Str(Js::JavascriptString* key, Js::PropertyId keyId, Js::Var holder);
         Js::Var Str(uint32 index, Js::Var holder);
@@ -68,6 +89,9 @@ namespace JSON
         Js::JavascriptString* Quote(Js::JavascriptString* value);
 
         Js::Var StringifyObject(Js::Var value);
+        JsonStringifyTypeCache* GetTypeCache(Js::RecyclableObject* object);
+        Js::JavascriptString* StringifyObjectWithTypeCache(Js::DynamicObject* object, JsonStringifyTypeCache* typeCache,
+            Js::JavascriptString* &indentString, Js::JavascriptString* &memberSeparator, bool &isEmpty);
 
         Js::Var StringifyArray(Js::Var value);
         Js::JavascriptString* GetArrayElementString(uint32 index, Js::Var arrayVar);
@@ -99,6 +123,16 @@ namespace JSON
         Js::JavascriptString* gap;
         uint indent;
         Js::JavascriptString* propertySeparator;     // colon or colon+space
+
+        // The type cache lives in a guest arena so that the types and strings it holds stay alive for the session
+        Js::TempGuestArenaAllocatorObject* arenaAllocatorObject;
+        typedef JsUtil::BaseDictionary<Js::DynamicType*, JsonStringifyTypeCache*, ArenaAllocator> JsonStringifyTypeCacheList;
+        JsonStringifyTypeCacheList* typeCacheList;
+
+        // A type is only cached the second time it is seen. Direct-mapped, so that records and the objects
+        // nested in them don't keep evicting each other.
+        static const uint RecentUncachedTypeCount = 8;
+        Js::DynamicType* recentUncachedTypes[RecentUncachedTypeCount];
         Js::Var StringifySession::StrHelper(Js::JavascriptString* key, Js::Var value, Js::Var holder);
     };
 } // namespace JSON
@@ -302,6 +302,8 @@ namespace JSON
                 }
                 JsonTypeCache* previousCache = nullptr;
                 JsonTypeCache* currentCache = nullptr;
+                JsonTypeCache* firstCache = nullptr;
+                int preallocatedSlotCapacity = 0;
                 //parse the list of members
                 while(true)
                 {
@@ -340,12 +342,30 @@ namespace JSON
                             DynamicType* typeWithProperty = currentCache->typeWithProperty;
                             PropertyId propertyId = currentCache->propertyRecord->GetPropertyId();
                             PropertyIndex propertyIndex = currentCache->propertyIndex;
+                            int finalSlotCapacity = currentCache->finalSlotCapacity;
+                            if(!previousCache)
+                            {
+                                firstCache = currentCache;
+                            }
                             previousCache = currentCache;
                             currentCache = currentCache->next;
 
                             // fast path for type transition and property set
-                            object->EnsureSlots(typeWithoutProperty->GetTypeHandler()->GetSlotCapacity(),
-                                typeWithProperty->GetTypeHandler()->GetSlotCapacity(), scriptContext, typeWithProperty->GetTypeHandler());
+                            DynamicTypeHandler* typeHandlerWithProperty = typeWithProperty->GetTypeHandler();
+                            int slotCapacity = typeHandlerWithProperty->GetSlotCapacity();
+                            if(firstCache == previousCache && finalSlotCapacity > slotCapacity &&
+                                typeHandlerWithProperty->GetInlineSlotCapacity() == typeWithoutProperty->GetTypeHandler()->GetInlineSlotCapacity())
+                            {
+                                // Objects starting with this property ended up this large last time; allocate all their slots now.
+                                // The aux slots may then be larger than the type handler's capacity, which only means later
+                                // transitions within that size need no reallocation.
+                                slotCapacity = finalSlotCapacity;
+                            }
+                            if(slotCapacity > preallocatedSlotCapacity)
+                            {
+                                object->EnsureSlots(typeWithoutProperty->GetTypeHandler()->GetSlotCapacity(), slotCapacity, scriptContext, typeHandlerWithProperty);
+                                preallocatedSlotCapacity = slotCapacity;
+                            }
                             object->ReplaceType(typeWithProperty);
                             Js::Var value = ParseObject();
                             object->SetSlot(SetSlotArguments(propertyId, propertyIndex, value));
@@ -372,6 +392,9 @@ namespace JSON
                     PropertyValueInfo info;
                     object->SetProperty(propertyRecord->GetPropertyId(), value, PropertyOperation_None, &info);
 
+                    // SetProperty sizes the slots from the type handler, which may be smaller than what we preallocated
+                    preallocatedSlotCapacity = 0;
+
                     DynamicType* typeWithProperty = object->GetDynamicType();
                     if(IsCaching() && !propertyRecord->IsNumeric() && !info.IsNoCache() && typeWithProperty->GetIsShared() && typeWithProperty->GetTypeHandler()->IsPathTypeHandler())
                     {
@@ -382,6 +405,7 @@ namespace JSON
                             // This is the first property in the set add it to the dictionary.
                             currentCache = JsonTypeCache::New(this->arenaAllocator, propertyRecord, typeWithoutProperty, typeWithProperty, propertyIndex);
                             typeCacheList->AddNew(propertyRecord, currentCache);
+                            firstCache = currentCache;
                         }
                         else if(!currentCache)
                         {
@@ -403,6 +427,16 @@ namespace JSON
                     Scan();
                 }
 
+                if(firstCache)
+                {
+                    DynamicTypeHandler* finalTypeHandler = object->GetDynamicType()->GetTypeHandler();
+                    if(finalTypeHandler->IsPathTypeHandler() &&
+                        finalTypeHandler->GetInlineSlotCapacity() == firstCache->typeWithoutProperty->GetTypeHandler()->GetInlineSlotCapacity())
+                    {
+                        firstCache->finalSlotCapacity = finalTypeHandler->GetSlotCapacity();
+                    }
+                }
+
                 // check  and consume the ending '}"
                 CheckCurrentToken(tkRCurly, JSERR_JsonNoRcurly);
                 return object;
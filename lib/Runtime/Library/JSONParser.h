@@ -16,13 +16,17 @@ namespace JSON
         Js::DynamicType* typeWithProperty;
         JsonTypeCache* next;
         Js::PropertyIndex propertyIndex;
+        // Only kept on the first entry of a chain: slot capacity of the last object that started with this
+        // property, used to size the slots of the next such object once instead of growing them per property.
+        int finalSlotCapacity;
 
         JsonTypeCache(const Js::PropertyRecord* propertyRecord, Js::DynamicType* typeWithoutProperty, Js::DynamicType* typeWithProperty, Js::PropertyIndex propertyIndex) :
             propertyRecord(propertyRecord),
             typeWithoutProperty(typeWithoutProperty),
             typeWithProperty(typeWithProperty),
             propertyIndex(propertyIndex),
-            next(nullptr) {}
+            next(nullptr),
+            finalSlotCapacity(0) {}
 
         static JsonTypeCache* JsonTypeCache::New(ArenaAllocator* allocator,
             const Js::PropertyRecord* propertyRecord,
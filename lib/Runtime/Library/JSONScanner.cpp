@@ -220,6 +220,60 @@ namespace JSON
         return true;
     }
 
+    // Advances currentChar over a run of characters that need no handling inside a string literal
+    // (anything but '"', '\\' and the \u0000 - \u001f range) and returns the length of the run.
+    uint JSONScanner::ScanPlainChars()
+    {
+        const char16* start = currentChar;
+        const char16* end = inputText + inputLen;
+
+#if defined(_M_IX86) || defined(_M_X64)
+#if defined(_M_IX86)
+        if (AutoSystemInfo::Data.SSE2Available())
+#endif
+        {
+            // Test 8 code units at a time. There is no unsigned 16-bit compare in SSE2, so
+            // "ch <= 0x1F" is computed as "saturating (ch - 0x1F) == 0".
+            const __m128i quote = _mm_set1_epi16('"');
+            const __m128i backslash = _mm_set1_epi16('\\');
+            const __m128i lastControlChar = _mm_set1_epi16(0x1F);
+            const __m128i zero = _mm_setzero_si128();
+
+            while (end - currentChar >= 8)
+            {
+                __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(currentChar));
+                __m128i special = _mm_or_si128(
+                    _mm_or_si128(_mm_cmpeq_epi16(chars, quote), _mm_cmpeq_epi16(chars, backslash)),
+                    _mm_cmpeq_epi16(_mm_subs_epu16(chars, lastControlChar), zero));
+
+                DWORD mask = (DWORD)_mm_movemask_epi8(special);
+                if (mask != 0)
+                {
+                    // Two mask bits per char16
+                    DWORD index;
+                    _BitScanForward(&index, mask);
+                    currentChar += index / sizeof(char16);
+                    return (uint)(currentChar - start);
+                }
+
+                currentChar += 8;
+            }
+        }
+#endif
+
+        while (currentChar < end)
+        {
+            char16 ch = PeekNextChar();
+            if (ch == '"' || ch == '\\' || ch <= 0x1F)
+            {
+                break;
+            }
+            currentChar++;
+        }
+
+        return (uint)(currentChar - start);
+    }
+
     tokens JSONScanner::ScanString()
     {
         char16 ch;
@@ -233,6 +287,13 @@ namespace JSON
 
         while (currentChar < inputText + inputLen)
         {
+            // Plain characters only extend the current bulk range, so consume whole runs of them at once
+            bulkLength += ScanPlainChars();
+            if (currentChar >= inputText + inputLen)
+            {
+                break;
+            }
+
             ch = ReadNextChar();
             int tempHex;
 
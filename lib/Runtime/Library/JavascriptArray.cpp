@@ -6036,28 +6036,26 @@ Case0:
         }
     }
 
-    static void hybridSort(__inout_ecount(length) Var *elements, uint32 length, CompareVarsInfo* compareInfo)
-    {
-        // The cost of memory moves starts to be more expensive than additional comparer calls (given a simple comparer)
-        // for arrays of more than 512 elements.
-        if (length > 512)
-        {
-            qsort_s(elements, length, sizeof(Var), compareVars, compareInfo);
-            return;
-        }
+    // Runs this short are binary insertion sorted before merging. Below it, memory moves are cheaper than the
+    // extra comparer calls a merge would make.
+    static const uint32 MergeSortRunLength = 32;
 
-        for (int i = 1; i < (int)length; i++)
+    template<typename T, typename Fn>
+    static void BinaryInsertionSort(__inout_ecount(length) T *elements, uint32 length, Fn compare)
+    {
+        for (uint32 i = 1; i < length; i++)
         {
-            if (compareVars(compareInfo, elements + i, elements + i - 1) < 0) {
-                // binary search for the left-most element greater than value:
-                int first = 0;
-                int last = i - 1;
-                while (first <= last)
+            if (compare(elements[i], elements[i - 1]) < 0)
+            {
+                // binary search for the left-most element greater than value, so that equal elements keep their order:
+                uint32 first = 0;
+                uint32 last = i - 1;
+                while (first < last)
                 {
-                    int middle = (first + last) / 2;
-                    if (compareVars(compareInfo, elements + i, elements + middle) < 0)
+                    uint32 middle = (first + last) / 2;
+                    if (compare(elements[i], elements[middle]) < 0)
                     {
-                        last = middle - 1;
+                        last = middle;
                     }
                     else
                     {
@@ -6066,13 +6064,76 @@ Case0:
                 }
 
                 // insert value right before first:
-                Var value = elements[i];
-                memmove(elements + first + 1, elements + first, (i - first) * sizeof(Var));
+                T value = elements[i];
+                memmove(elements + first + 1, elements + first, (i - first) * sizeof(T));
                 elements[first] = value;
             }
         }
     }
 
+    template<typename T, typename Fn>
+    static void MergeRuns(__inout_ecount(high) T *elements, uint32 low, uint32 middle, uint32 high, __out_ecount(high) T *scratch, Fn compare)
+    {
+        // Runs that are already in order need no merge, which keeps sorted and nearly sorted input linear
+        if (compare(elements[middle], elements[middle - 1]) >= 0)
+        {
+            return;
+        }
+
+        // The merge is written to the scratch buffer and only copied back once complete, so the elements stay a
+        // permutation of the input if the comparer throws
+        uint32 left = low;
+        uint32 right = middle;
+        uint32 out = low;
+        while (left < middle && right < high)
+        {
+            // Take from the right run only when it is strictly smaller, so equal elements keep their order
+            if (compare(elements[right], elements[left]) < 0)
+            {
+                scratch[out++] = elements[right++];
+            }
+            else
+            {
+                scratch[out++] = elements[left++];
+            }
+        }
+        while (left < middle)
+        {
+            scratch[out++] = elements[left++];
+        }
+
+        // Whatever is left of the right run is already in place
+        js_memcpy_s(elements + low, (high - low) * sizeof(T), scratch + low, (out - low) * sizeof(T));
+    }
+
+    // Stable merge sort: runs of MergeSortRunLength elements are insertion sorted in place, then merged bottom up.
+    // compare returns <0, 0 or >0 like a sort comparer.
+    template<typename T, typename Fn>
+    static void MergeSort(__inout_ecount(length) T *elements, uint32 length, ArenaAllocator *tempAlloc, Fn compare)
+    {
+        for (uint32 start = 0; start < length; start += MergeSortRunLength)
+        {
+            BinaryInsertionSort(elements + start, min(MergeSortRunLength, length - start), compare);
+        }
+
+        if (length <= MergeSortRunLength)
+        {
+            return;
+        }
+
+        T *scratch = AnewArray(tempAlloc, T, length);
+        for (uint32 width = MergeSortRunLength; width < length; width = (width <= length / 2) ? width * 2 : length)
+        {
+            for (uint32 low = 0; length - low > width; )
+            {
+                uint32 middle = low + width;
+                uint32 high = (length - middle > width) ? middle + width : length;
+                MergeRuns(elements, low, middle, high, scratch, compare);
+                low = high;
+            }
+        }
+    }
+
     void JavascriptArray::Sort(RecyclableObject* compFn)
     {
         if (length <= 1)
@@ -6087,6 +6148,7 @@ Case0:
         CompareVarsInfo cvInfo;
         cvInfo.scriptContext = scriptContext;
         cvInfo.compFn = compFn;
+        auto compareVarsFn = [&](Var x, Var y) { return compareVars(&cvInfo, &x, &y); };
 
         Assert(head != nullptr);
 
@@ -6104,8 +6166,13 @@ Case0:
         this->InvalidateLastUsedSegment();
         length = 0;
 
+        // Scratch space for the merge sort, released in the finally below since the compare function may throw
+        DECLARE_TEMP_ALLOCATOR(tempAlloc);
+
         TryFinally([&]()
         {
+            ACQUIRE_TEMP_ALLOCATOR(tempAlloc, scriptContext, _u("Runtime"));
+
             //The array is a continuous array if there is only one segment
             if (startSeg->next == nullptr) // Single segment fast path
             {
@@ -6116,11 +6183,11 @@ Case0:
 #ifdef VALIDATE_ARRAY
                     ValidateSegment(startSeg);
 #endif
-                    hybridSort(startSeg->elements, startSeg->length, &cvInfo);
+                    MergeSort(startSeg->elements, startSeg->length, tempAlloc, compareVarsFn);
                 }
                 else
                 {
-                    countUndefined = sort(startSeg->elements, &startSeg->length, scriptContext);
+                    countUndefined = sort(startSeg->elements, &startSeg->length, tempAlloc, scriptContext);
                 }
                 head = startSeg;
             }
@@ -6148,11 +6215,11 @@ Case0:
 
                 if (compFn != nullptr)
                 {
-                    hybridSort(allElements->elements, allElements->length, &cvInfo);
+                    MergeSort(allElements->elements, allElements->length, tempAlloc, compareVarsFn);
                 }
                 else
                 {
-                    sort(allElements->elements, &allElements->length, scriptContext);
+                    sort(allElements->elements, &allElements->length, tempAlloc, scriptContext);
                 }
 
                 head = allElements;
@@ -6161,6 +6228,8 @@ Case0:
         },
         [&](bool hasException)
         {
+            RELEASE_TEMP_ALLOCATOR(tempAlloc, scriptContext);
+
             length = saveLength;
             ClearSegmentMap(); // Dump the segmentMap again in case user compare function rebuilds it
             if (hasException)
@@ -6212,66 +6281,156 @@ Case0:
         return;
     }
 
-    uint32 JavascriptArray::sort(__inout_ecount(*len) Var *orig, uint32 *len, ScriptContext *scriptContext)
+    uint32 JavascriptArray::sort(__inout_ecount(*len) Var *orig, uint32 *len, ArenaAllocator *tempAlloc, ScriptContext *scriptContext)
     {
         uint32 count = 0, countUndefined = 0;
-        Element *elements = RecyclerNewArrayZ(scriptContext->GetRecycler(), Element, *len);
+        bool allStrings = true;
         RecyclableObject *undefined = scriptContext->GetLibrary()->GetUndefined();
 
         //
-        // Create the Elements array
+        // Compact the values to the front, keeping their order
         //
 
         for (uint32 i = 0; i < *len; ++i)
         {
             if (!SparseArraySegment<Var>::IsMissingItem(&orig[i]))
             {
-                if (!JavascriptOperators::IsUndefinedObject(orig[i], undefined))
+                Var value = orig[i];
+                if (!JavascriptOperators::IsUndefinedObject(value, undefined))
                 {
-                    elements[count].Value = orig[i];
-                    elements[count].StringValue =  JavascriptConversion::ToString(orig[i], scriptContext);
-
+                    allStrings = allStrings && JavascriptString::Is(value);
+                    orig[count] = value;
                     count++;
                 }
                 else
                 {
                     countUndefined++;
                 }
-                orig[i] = SparseArraySegment<Var>::GetMissingItem();
             }
         }
 
+        for (uint32 i = count; i < *len; ++i)
+        {
+            orig[i] = SparseArraySegment<Var>::GetMissingItem();
+        }
+
+        *len = count; // set the correct length
+
         if (count == 0)
         {
-            *len = 0; // set the length to zero
             return countUndefined;
         }
 
-        SortElements(elements, 0, count - 1);
+        if (allStrings)
+        {
+            // The values are their own string values, sort them directly
+            MergeSort(orig, count, tempAlloc, [](Var x, Var y)
+            {
+                return JavascriptString::strcmp(JavascriptString::FromVar(x), JavascriptString::FromVar(y));
+            });
+            return countUndefined;
+        }
+
+        //
+        // Create the Elements array
+        //
+
+        Element *elements = RecyclerNewArrayZ(scriptContext->GetRecycler(), Element, count);
+        for (uint32 i = 0; i < count; ++i)
+        {
+            elements[i].Value = orig[i];
+            elements[i].StringValue = JavascriptConversion::ToString(orig[i], scriptContext);
+        }
+
+        MergeSort(elements, count, tempAlloc, [](const Element& x, const Element& y)
+        {
+            return JavascriptString::strcmp(x.StringValue, y.StringValue);
+        });
 
         for (uint32 i = 0; i < count; ++i)
         {
             orig[i] = elements[i].Value;
         }
 
-        *len = count; // set the correct length
         return countUndefined;
     }
 
-    int __cdecl JavascriptArray::CompareElements(void* context, const void* elem1, const void* elem2)
+    // Orders two int32s the way their decimal strings compare, without creating the strings
+    static int CompareInt32AsStrings(int32 x, int32 y)
     {
-        const Element* element1 = static_cast<const Element*>(elem1);
-        const Element* element2 = static_cast<const Element*>(elem2);
+        if ((x < 0) != (y < 0))
+        {
+            // '-' sorts before every digit
+            return x < 0 ? -1 : 1;
+        }
 
-        Assert(element1 != NULL);
-        Assert(element2 != NULL);
+        uint64 digitsX = x < 0 ? (uint64)(-(int64)x) : (uint64)x;
+        uint64 digitsY = y < 0 ? (uint64)(-(int64)y) : (uint64)y;
+
+        uint countX = 1;
+        for (uint64 value = digitsX; value >= 10; value /= 10)
+        {
+            countX++;
+        }
+        uint countY = 1;
+        for (uint64 value = digitsY; value >= 10; value /= 10)
+        {
+            countY++;
+        }
 
-        return JavascriptString::strcmp(element1->StringValue, element2->StringValue);
+        // Pad the shorter one with zeros to the same number of digits. If the digits then match,
+        // the shorter string is a prefix of the longer one and sorts first.
+        for (uint i = countX; i < countY; i++)
+        {
+            digitsX *= 10;
+        }
+        for (uint i = countY; i < countX; i++)
+        {
+            digitsY *= 10;
+        }
+
+        if (digitsX != digitsY)
+        {
+            return digitsX < digitsY ? -1 : 1;
+        }
+        return countX < countY ? -1 : (countX > countY ? 1 : 0);
     }
 
-    void JavascriptArray::SortElements(Element* elements, uint32 left, uint32 right)
+    void JavascriptNativeIntArray::SortAsStrings()
     {
-        qsort_s(elements, right - left + 1, sizeof(Element), CompareElements, this);
+        // Sorting with the default comparer runs no user code, so the single segment is sorted in place
+        // and the array stays native
+        Assert(IsSingleSegmentArray() && head->left == 0);
+
+        SparseArraySegment<int32>* seg = (SparseArraySegment<int32>*)head;
+
+        // Move the missing items to the end, like JavascriptArray::Sort does
+        uint32 count = 0;
+        for (uint32 i = 0; i < seg->length; i++)
+        {
+            if (!SparseArraySegment<int32>::IsMissingItem(&seg->elements[i]))
+            {
+                seg->elements[count++] = seg->elements[i];
+            }
+        }
+        if (count != seg->length)
+        {
+            seg->Truncate(count);
+        }
+
+        ScriptContext* scriptContext = this->GetScriptContext();
+        BEGIN_TEMP_ALLOCATOR(tempAlloc, scriptContext, _u("Runtime"))
+        {
+            MergeSort(seg->elements, count, tempAlloc, CompareInt32AsStrings);
+        }
+        END_TEMP_ALLOCATOR(tempAlloc, scriptContext);
+
+        SetHasNoMissingValues();
+        this->InvalidateLastUsedSegment();
+
+#ifdef VALIDATE_ARRAY
+        ValidateArray();
+#endif
     }
 
     Var JavascriptArray::EntrySort(RecyclableObject* function, CallInfo callInfo, ...)
@@ -6325,6 +6484,12 @@ Case0:
                 arr->FillFromPrototypes(0, arr->length); // We need find all missing value from [[proto]] object
             }
 
+            if (!compFn && JavascriptNativeIntArray::Is(arr) && arr->IsSingleSegmentArray() && arr->head->left == 0)
+            {
+                JavascriptNativeIntArray::FromVar(arr)->SortAsStrings();
+                return args[0];
+            }
+
             // Maintain nativity of the array only for the following cases (To favor inplace conversions - keeps the conversion cost less):
             // -    int cases for X86 and
             // -    FloatArray for AMD64
@@ -88,6 +88,7 @@ namespace Js
     {
         template <class TPropertyIndex>
         friend class ES5ArrayTypeHandlerBase;
+        friend class JavascriptNativeIntArray;
 
     public:
         static const size_t StackAllocationSize;
@@ -543,7 +544,7 @@ namespace Js
         template<typename T> void AllocateHead();
         template<typename T> void EnsureHead();
 
-        uint32 sort(__inout_ecount(*length) Var *orig, uint32 *length, ScriptContext *scriptContext);
+        uint32 sort(__inout_ecount(*length) Var *orig, uint32 *length, ArenaAllocator *tempAlloc, ScriptContext *scriptContext);
 
         BOOL GetPropertyBuiltIns(PropertyId propertyId, Var* value);
         bool GetSetterBuiltIns(PropertyId propertyId, PropertyValueInfo* info, DescriptorFlags* descriptorFlags);
@@ -553,9 +554,6 @@ namespace Js
             JavascriptString* StringValue;
         };
 
-        static int __cdecl CompareElements(void* context, const void* elem1, const void* elem2);
-        void SortElements(Element* elements, uint32 left, uint32 right);
-
         template <typename Fn>
         static void ForEachOwnArrayIndexOfObject(RecyclableObject* obj, uint32 startIndex, uint32 limitIndex, Fn fn);
 
@@ -936,6 +934,7 @@ namespace Js
         static JavascriptArray * ConvertToVarArray(JavascriptNativeIntArray *intArray);
         static Var Push(ScriptContext * scriptContext, Var array, int value);
         static int32 Pop(ScriptContext * scriptContext, Var nativeIntArray);
+        void SortAsStrings();
 
 #if ENABLE_PROFILE_INFO
         virtual JavascriptArray *FillFromArgs(uint length, uint start, Var *args, ArrayCallSiteInfo *info = nullptr, bool dontCreateNewArray = false) override;
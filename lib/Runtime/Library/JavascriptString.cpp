@@ -337,6 +337,13 @@ namespace Js
     {
         AssertMsg( IsValidIndexValue(index), "Must specify valid character");
 
+        // Read a one-byte string in place rather than widen it for a single character
+        const unsigned char *latin1Str = this->TryGetLatin1Buffer();
+        if (latin1Str != nullptr)
+        {
+            return latin1Str[index];
+        }
+
         const char16 *str = this->GetString();
         return str[index];
     }
@@ -1074,6 +1081,12 @@ case_2:
         if (position < pThis->GetLengthAsSignedInt())
         {
             const char16* searchStr = searchString->GetString();
+            const unsigned char* latin1InputStr = pThis->TryGetLatin1Buffer();
+            if (latin1InputStr != nullptr)
+            {
+                return Latin1IndexOf(latin1InputStr, len, searchStr, searchLen, position);
+            }
+
             const char16* inputStr = pThis->GetString();
             if (searchLen == 1)
             {
@@ -3008,6 +3021,13 @@ case_2:
             return false;
         }
 
+        const unsigned char * leftLatin1 = leftString->TryGetLatin1Buffer();
+        const unsigned char * rightLatin1 = rightString->TryGetLatin1Buffer();
+        if (leftLatin1 != nullptr || rightLatin1 != nullptr)
+        {
+            return Latin1Equals(leftString, leftLatin1, rightString, rightLatin1);
+        }
+
         if (wmemcmp(leftString->GetString(), rightString->GetString(), leftString->GetLength()) == 0)
         {
             return true;
@@ -3534,11 +3554,89 @@ case_2:
         return (uint)-1;
     }
 
+    // Searches a one-byte string for a char16 one without widening it. The first character is
+    // found with memchr and the rest compared in place.
+    int JavascriptString::Latin1IndexOf(const unsigned char* inputStr, int len, const char16* searchStr, int searchLen, int position)
+    {
+        Assert(searchLen > 0 && position >= 0 && position <= len);
+
+        if (searchLen > len - position)
+        {
+            return -1;
+        }
+
+        // A character that doesn't fit in one byte can't be in the input
+        for (int j = 0; j < searchLen; j++)
+        {
+            if (searchStr[j] > 0xFF)
+            {
+                return -1;
+            }
+        }
+
+        const unsigned char firstChar = static_cast<unsigned char>(searchStr[0]);
+        const unsigned char* const lastStart = inputStr + (len - searchLen);
+        const unsigned char* current = inputStr + position;
+        while (current <= lastStart)
+        {
+            current = static_cast<const unsigned char*>(memchr(current, firstChar, lastStart - current + 1));
+            if (current == nullptr)
+            {
+                return -1;
+            }
+
+            int j = 1;
+            while (j < searchLen && current[j] == searchStr[j])
+            {
+                j++;
+            }
+            if (j == searchLen)
+            {
+                return static_cast<int>(current - inputStr);
+            }
+            current++;
+        }
+        return -1;
+    }
+
+    bool JavascriptString::Latin1Equals(JavascriptString * leftString, const unsigned char * leftLatin1, JavascriptString * rightString, const unsigned char * rightLatin1)
+    {
+        Assert(leftString->GetLength() == rightString->GetLength());
+        Assert(leftLatin1 != nullptr || rightLatin1 != nullptr);
+
+        const charcount_t length = leftString->GetLength();
+        if (leftLatin1 != nullptr && rightLatin1 != nullptr)
+        {
+            return JsUtil::CharacterBuffer<unsigned char>::StaticEquals(leftLatin1, rightLatin1, length);
+        }
+
+        // Only one side is still one-byte; compare against the other side's char16 form without widening this one
+        const unsigned char * latin1 = (leftLatin1 != nullptr) ? leftLatin1 : rightLatin1;
+        const char16 * wide = (leftLatin1 != nullptr) ? rightString->GetString() : leftString->GetString();
+        for (charcount_t i = 0; i < length; i++)
+        {
+            if (wide[i] != latin1[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     int JavascriptString::strcmp(JavascriptString *string1, JavascriptString *string2)
     {
         uint string1Len = string1->GetLength();
         uint string2Len = string2->GetLength();
 
+        const unsigned char * latin1String1 = string1->TryGetLatin1Buffer();
+        const unsigned char * latin1String2 = string2->TryGetLatin1Buffer();
+        if (latin1String1 != nullptr && latin1String2 != nullptr)
+        {
+            // Unsigned bytes order the same way as the char16 code units they widen to
+            int latin1Result = memcmp(latin1String1, latin1String2, min(string1Len, string2Len));
+            return (latin1Result == 0) ? (int)(string1Len - string2Len) : latin1Result;
+        }
+
         int result = wmemcmp(string1->GetString(), string2->GetString(), min(string1Len, string2Len));
 
         return (result == 0) ? (int)(string1Len - string2Len) : result;
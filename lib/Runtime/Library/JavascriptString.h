@@ -68,9 +68,22 @@ namespace Js
         BOOL GetItemAt(charcount_t idxChar, Var* value);
         char16 GetItem(charcount_t index);
 
+        // Hashes a not yet widened Latin1String from its one-byte buffer; the hash is the same as for the char16 form
+        uint GetHashCode()
+        {
+            const unsigned char * latin1Buffer = this->TryGetLatin1Buffer();
+            if (latin1Buffer != nullptr)
+            {
+                return JsUtil::CharacterBuffer<unsigned char>::StaticGetHashCode(latin1Buffer, this->GetLength());
+            }
+            return JsUtil::CharacterBuffer<char16>::StaticGetHashCode(this->GetString(), this->GetLength());
+        }
+
         _Ret_range_(m_charLength, m_charLength) charcount_t GetLength() const;
         virtual size_t GetAllocatedByteCount() const;
         virtual bool IsSubstring() const;
+        virtual const unsigned char * GetLatin1Buffer() const { return nullptr; } // One-byte contents of a not yet widened Latin1String
+        const unsigned char * TryGetLatin1Buffer() const { return this->IsFinalized() ? nullptr : this->GetLatin1Buffer(); }
         int GetLengthAsSignedInt() const;
         const char16* UnsafeGetBuffer() const;
         LPCWSTR GetSzCopy(ArenaAllocator* alloc);   // Copy to an Arena
@@ -146,6 +159,8 @@ namespace Js
         static int strcmp(JavascriptString *string1, JavascriptString *string2);
 
     private:
+        static bool Latin1Equals(JavascriptString * leftString, const unsigned char * leftLatin1, JavascriptString * rightString, const unsigned char * rightLatin1);
+
         enum ToCase{
             ToLower,
             ToUpper
@@ -154,6 +169,7 @@ namespace Js
 
         static Var ToCaseCore(JavascriptString* pThis, ToCase toCase);
         static int IndexOfUsingJmpTable(JmpTable jmpTable, const char16* inputStr, int len, const char16* searchStr, int searchLen, int position);
+        static int Latin1IndexOf(const unsigned char* inputStr, int len, const char16* searchStr, int searchLen, int position);
         static int LastIndexOfUsingJmpTable(JmpTable jmpTable, const char16* inputStr, int len, const char16* searchStr, int searchLen, int position);
         static bool BuildLastCharForwardBoyerMooreTable(JmpTable jmpTable, const char16* searchStr, int searchLen);
         static bool BuildFirstCharBackwardBoyerMooreTable(JmpTable jmpTable, const char16* searchStr, int searchLen);
@@ -388,7 +404,7 @@ namespace Js
 
         inline static uint GetHashCode(JavascriptString * str)
         {
-            return JsUtil::CharacterBuffer<WCHAR>::StaticGetHashCode(str->GetString(), str->GetLength());
+            return str->GetHashCode();
         }
     };
 
@@ -409,6 +425,6 @@ struct DefaultComparer<Js::JavascriptString*>
 
     inline static uint GetHashCode(Js::JavascriptString * pStr)
     {
-        return JsUtil::CharacterBuffer<char16>::StaticGetHashCode(pStr->GetString(), pStr->GetLength());
+        return pStr->GetHashCode();
     }
 };
@@ -0,0 +1,107 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLibraryPch.h"
+
+namespace Js
+{
+    inline Latin1String::Latin1String(const unsigned char * latin1Buffer, charcount_t length, ScriptContext * scriptContext) :
+        JavascriptString(scriptContext->GetLibrary()->GetStringTypeStatic()),
+        latin1Buffer(latin1Buffer)
+    {
+        this->SetLength(length);
+    }
+
+    bool Latin1String::IsLatin1(__in_ecount(length) const char16 * content, charcount_t length)
+    {
+        for (charcount_t i = 0; i < length; i++)
+        {
+            if (content[i] > 0xFF)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    JavascriptString * Latin1String::NewCopyBuffer(__in_ecount(length) const char16 * content, charcount_t length, ScriptContext * scriptContext)
+    {
+        AssertMsg(IsValidCharCount(length), "length is out of range");
+        Assert(IsLatin1(content, length));
+
+        if (!length)
+        {
+            return scriptContext->GetLibrary()->GetEmptyString();
+        }
+
+        Recycler * recycler = scriptContext->GetRecycler();
+        unsigned char * buffer = RecyclerNewArrayLeaf(recycler, unsigned char, length);
+        for (charcount_t i = 0; i < length; i++)
+        {
+            buffer[i] = static_cast<unsigned char>(content[i]);
+        }
+
+#ifdef PROFILE_STRINGS
+        StringProfiler::RecordNewString(scriptContext, content, length);
+#endif
+        return RecyclerNew(recycler, Latin1String, buffer, length, scriptContext);
+    }
+
+    JavascriptString * Latin1String::NewCopyBufferIfLatin1(__in_ecount(length) const char16 * content, charcount_t length, ScriptContext * scriptContext)
+    {
+        // Single characters come from the char string cache either way
+        if (length > 1 && Configuration::Global.flags.Latin1Strings && IsLatin1(content, length))
+        {
+            return Latin1String::NewCopyBuffer(content, length, scriptContext);
+        }
+        return JavascriptString::NewCopyBuffer(content, length, scriptContext);
+    }
+
+    const char16* Latin1String::GetSz()
+    {
+        if (latin1Buffer)
+        {
+            Recycler * recycler = this->GetScriptContext()->GetRecycler();
+            const charcount_t length = this->GetLength();
+            char16 * widened = RecyclerNewArrayLeaf(recycler, char16, length + 1);
+            for (charcount_t i = 0; i < length; i++)
+            {
+                widened[i] = latin1Buffer[i];
+            }
+            widened[length] = _u('\0');
+            this->SetBuffer(widened);
+
+            // Once widened, the string is an ordinary finalized string; drop the one-byte copy
+            latin1Buffer = nullptr;
+        }
+
+        return UnsafeGetBuffer();
+    }
+
+    size_t Latin1String::GetAllocatedByteCount() const
+    {
+        if (latin1Buffer)
+        {
+            return this->GetLength() * sizeof(unsigned char);
+        }
+        return __super::GetAllocatedByteCount();
+    }
+
+    void Latin1String::CopyVirtual(
+        _Out_writes_(m_charLength) char16 *const buffer,
+        StringCopyInfoStack &nestedStringTreeCopyInfos,
+        const byte recursionDepth)
+    {
+        Assert(buffer);
+        Assert(!this->IsFinalized());
+        Assert(latin1Buffer);
+
+        // Widen straight into the destination, leaving this string in its one-byte form
+        const charcount_t length = this->GetLength();
+        for (charcount_t i = 0; i < length; i++)
+        {
+            buffer[i] = latin1Buffer[i];
+        }
+    }
+}
@@ -0,0 +1,34 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js
+{
+    // A string whose characters all fit in one byte (U+0000 - U+00FF). The characters are kept in a
+    // one-byte buffer and the string stays unfinalized, so callers that only need to hash, compare,
+    // index into, search or copy it into a larger string never pay for the char16 form. The first
+    // GetSz widens it.
+    class Latin1String sealed : public JavascriptString
+    {
+        const unsigned char * latin1Buffer;                 // nullptr once the string has been widened
+        Latin1String(const unsigned char * latin1Buffer, charcount_t length, ScriptContext * scriptContext);
+
+    protected:
+        DEFINE_VTABLE_CTOR(Latin1String, JavascriptString);
+        DECLARE_CONCRETE_STRING_CLASS;
+
+    public:
+        static bool IsLatin1(__in_ecount(length) const char16 * content, charcount_t length);
+        static JavascriptString * NewCopyBuffer(__in_ecount(length) const char16 * content, charcount_t length, ScriptContext * scriptContext);
+        // For strings coming in from the host through JSRT: a Latin1String when -Latin1Strings is on and
+        // every character fits, an ordinary copy otherwise
+        static JavascriptString * NewCopyBufferIfLatin1(__in_ecount(length) const char16 * content, charcount_t length, ScriptContext * scriptContext);
+
+        virtual const char16* GetSz() override;
+        virtual const unsigned char * GetLatin1Buffer() const override { return latin1Buffer; }
+        virtual size_t GetAllocatedByteCount() const override;
+        virtual void CopyVirtual(_Out_writes_(m_charLength) char16 *const buffer, StringCopyInfoStack &nestedStringTreeCopyInfos, const byte recursionDepth) override;
+    };
+}
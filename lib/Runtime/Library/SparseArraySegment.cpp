@@ -67,7 +67,8 @@ namespace Js
         return false;
     }
 
-    // Remove null/undefined from this segment. May reorder elements and compact this segment in preparing for sort.
+    // Remove null/undefined from this segment, compacting it in preparation for sort. The remaining
+    // elements keep their relative order, which the stable sort relies on.
     uint32 SparseArraySegmentBase::RemoveUndefined(ScriptContext* scriptContext)
     {
         SparseArraySegment<Var> *_this = (SparseArraySegment<Var>*)this;
@@ -80,47 +81,20 @@ namespace Js
         //remove undefine values
         RecyclableObject *undefined = scriptContext->GetLibrary()->GetUndefined();
 
-        uint32 i = 0;
-        uint32 j = length - 1;
+        uint32 newLen = 0;
         uint32 countUndefined = 0;
 
-        while (i <= j)
+        for (uint32 i = 0; i < length; i++)
         {
-            //get the first null/undefined slot from left
-            while (i < j && !IsMissingOrUndefined(_this->elements[i], undefined, countUndefined))
+            Var value = _this->elements[i];
+            if (!IsMissingOrUndefined(value, undefined, countUndefined))
             {
-                i++;
-            }
-            bool iIsMissingOrUndefined = (i < j); // Flag to avoid test again if later j comes down to == i
-
-            //get the first slot which is not null/undefined from the right
-            while (i < j && IsMissingOrUndefined(_this->elements[j], undefined, countUndefined))
-            {
-                j--;
-            }
-
-            if (i < j)
-            {
-                //move
-                _this->elements[i] = _this->elements[j];
-                i++;
-                j--;
-            }
-            else
-            {
-                Assert(i == j);
-                if (iIsMissingOrUndefined || IsMissingOrUndefined(_this->elements[j], undefined, countUndefined))
-                {
-                    j--; // ok if j becomes -1. We'll truncate to length (j + 1).
-                }
-                break; // done
+                _this->elements[newLen++] = value;
             }
         }
 
-        if (j != length - 1) // Truncate if j has changed
+        if (newLen != length) // Truncate if anything was removed
         {
-            uint32 newLen = j + 1;
-            Assert(newLen < length);
             Assert(countUndefined <= length - newLen);
 
             _this->Truncate(left + newLen); // Truncate to new length (also clears moved elements)
@@ -2664,6 +2664,244 @@ namespace Js
         }
     }
 
+    namespace TypedArraySort
+    {
+        // Below this many elements an introsort beats the fixed cost of the radix passes
+        static const uint32 MinRadixSortLength = 256;
+        static const uint32 InsertionSortLength = 16;
+
+        // Unsigned keys that order like the signed or unsigned integers they come from
+        inline uint8 ToKey(bool value) { return (uint8)value; }
+        inline uint8 ToKey(int8 value) { return (uint8)value ^ 0x80; }
+        inline uint8 ToKey(uint8 value) { return value; }
+        inline uint16 ToKey(int16 value) { return (uint16)value ^ 0x8000; }
+        inline uint16 ToKey(uint16 value) { return value; }
+        inline uint32 ToKey(int32 value) { return (uint32)value ^ 0x80000000; }
+        inline uint32 ToKey(uint32 value) { return value; }
+
+        template<typename T>
+        inline void Swap(T* a, T* b)
+        {
+            T temp = *a;
+            *a = *b;
+            *b = temp;
+        }
+
+        template<typename T, typename TLess>
+        void InsertionSort(T* first, T* last, TLess less)
+        {
+            for (T* current = first + 1; current < last; current++)
+            {
+                T value = *current;
+                T* hole = current;
+                for (; hole > first && less(value, hole[-1]); hole--)
+                {
+                    *hole = hole[-1];
+                }
+                *hole = value;
+            }
+        }
+
+        template<typename T, typename TLess>
+        void SiftDown(T* heap, size_t index, size_t count, TLess less)
+        {
+            T value = heap[index];
+            for (size_t child = 2 * index + 1; child < count; child = 2 * index + 1)
+            {
+                if (child + 1 < count && less(heap[child], heap[child + 1]))
+                {
+                    child++;
+                }
+                if (!less(value, heap[child]))
+                {
+                    break;
+                }
+                heap[index] = heap[child];
+                index = child;
+            }
+            heap[index] = value;
+        }
+
+        template<typename T, typename TLess>
+        void HeapSort(T* first, T* last, TLess less)
+        {
+            size_t count = last - first;
+            for (size_t i = count / 2; i > 0; i--)
+            {
+                SiftDown(first, i - 1, count, less);
+            }
+            for (size_t end = count - 1; end > 0; end--)
+            {
+                Swap(first, first + end);
+                SiftDown(first, 0, end, less);
+            }
+        }
+
+        template<typename T, typename TLess>
+        void IntroSortLoop(T* first, T* last, uint depthLimit, TLess less)
+        {
+            while ((size_t)(last - first) > InsertionSortLength)
+            {
+                if (depthLimit == 0)
+                {
+                    // Partitioning keeps going badly; fall back to the guaranteed n log n
+                    HeapSort(first, last, less);
+                    return;
+                }
+                depthLimit--;
+
+                // Median of three as the pivot, which also keeps both scans below inside the range
+                T* middle = first + (last - first) / 2;
+                T* lastElement = last - 1;
+                if (less(*middle, *first)) Swap(middle, first);
+                if (less(*lastElement, *middle))
+                {
+                    Swap(lastElement, middle);
+                    if (less(*middle, *first)) Swap(middle, first);
+                }
+                const T pivot = *middle;
+
+                T* left = first;
+                T* right = last;
+                while (true)
+                {
+                    while (less(*left, pivot)) left++;
+                    right--;
+                    while (less(pivot, *right)) right--;
+                    if (left >= right)
+                    {
+                        break;
+                    }
+                    Swap(left, right);
+                    left++;
+                }
+
+                IntroSortLoop(left, last, depthLimit, less);
+                last = left;
+            }
+            InsertionSort(first, last, less);
+        }
+
+        template<typename T, typename TLess>
+        void IntroSort(T* elements, uint32 length, TLess less)
+        {
+            if (length < 2)
+            {
+                return;
+            }
+            uint depthLimit = 0;
+            for (uint32 n = length; n > 1; n >>= 1)
+            {
+                depthLimit += 2;
+            }
+            IntroSortLoop(elements, elements + length, depthLimit, less);
+        }
+
+        // LSD radix sort a byte of the key at a time, skipping the bytes that are the same in every element
+        template<typename T>
+        void RadixSort(T* elements, uint32 length, ArenaAllocator* tempAlloc)
+        {
+            typedef decltype(ToKey(T())) KeyType;
+            const uint passCount = sizeof(KeyType);
+
+            uint32 counts[passCount][256];
+            memset(counts, 0, sizeof(counts));
+            for (uint32 i = 0; i < length; i++)
+            {
+                KeyType key = ToKey(elements[i]);
+                for (uint pass = 0; pass < passCount; pass++)
+                {
+                    counts[pass][(key >> (pass * 8)) & 0xFF]++;
+                }
+            }
+
+            T* from = elements;
+            T* to = AnewArray(tempAlloc, T, length);
+            for (uint pass = 0; pass < passCount; pass++)
+            {
+                const uint shift = pass * 8;
+                uint32* passCounts = counts[pass];
+                if (passCounts[(ToKey(from[0]) >> shift) & 0xFF] == length)
+                {
+                    continue;
+                }
+
+                uint32 offset = 0;
+                for (uint bucket = 0; bucket < 256; bucket++)
+                {
+                    uint32 count = passCounts[bucket];
+                    passCounts[bucket] = offset;
+                    offset += count;
+                }
+
+                for (uint32 i = 0; i < length; i++)
+                {
+                    T value = from[i];
+                    to[passCounts[(ToKey(value) >> shift) & 0xFF]++] = value;
+                }
+
+                T* temp = from;
+                from = to;
+                to = temp;
+            }
+
+            if (from != elements)
+            {
+                js_memcpy_s(elements, length * sizeof(T), from, length * sizeof(T));
+            }
+        }
+
+        template<typename T>
+        void SortIntegers(T* elements, uint32 length, ArenaAllocator* tempAlloc)
+        {
+            if (length < MinRadixSortLength)
+            {
+                IntroSort(elements, length, [](T x, T y) { return x < y; });
+                return;
+            }
+            RadixSort(elements, length, tempAlloc);
+        }
+
+        // NaNs go last, and -0 sorts before +0 although the two compare equal
+        template<typename T>
+        void SortFloats(T* elements, uint32 length)
+        {
+            uint32 numberCount = 0;
+            for (uint32 i = 0; i < length; i++)
+            {
+                if (!NumberUtilities::IsNan((double)elements[i]))
+                {
+                    // Swap rather than overwrite, so the NaNs keep their bit patterns
+                    Swap(elements + numberCount, elements + i);
+                    numberCount++;
+                }
+            }
+
+            IntroSort(elements, numberCount, [](T x, T y)
+            {
+                return x < y || (x == 0 && y == 0 && JavascriptNumber::IsNegZero((double)x) && !JavascriptNumber::IsNegZero((double)y));
+            });
+        }
+
+        // The default order for each element type
+        inline void Sort(bool* elements, uint32 length, ArenaAllocator* tempAlloc) { SortIntegers(elements, length, tempAlloc); }
+        inline void Sort(int8* elements, uint32 length, ArenaAllocator* tempAlloc) { SortIntegers(elements, length, tempAlloc); }
+        inline void Sort(uint8* elements, uint32 length, ArenaAllocator* tempAlloc) { SortIntegers(elements, length, tempAlloc); }
+        inline void Sort(int16* elements, uint32 length, ArenaAllocator* tempAlloc) { SortIntegers(elements, length, tempAlloc); }
+        inline void Sort(uint16* elements, uint32 length, ArenaAllocator* tempAlloc) { SortIntegers(elements, length, tempAlloc); }
+        inline void Sort(int32* elements, uint32 length, ArenaAllocator* tempAlloc) { SortIntegers(elements, length, tempAlloc); }
+        inline void Sort(uint32* elements, uint32 length, ArenaAllocator* tempAlloc) { SortIntegers(elements, length, tempAlloc); }
+        inline void Sort(int64* elements, uint32 length, ArenaAllocator* tempAlloc) { IntroSort(elements, length, [](int64 x, int64 y) { return x < y; }); }
+        inline void Sort(uint64* elements, uint32 length, ArenaAllocator* tempAlloc) { IntroSort(elements, length, [](uint64 x, uint64 y) { return x < y; }); }
+        inline void Sort(float* elements, uint32 length, ArenaAllocator* tempAlloc) { SortFloats(elements, length); }
+        inline void Sort(double* elements, uint32 length, ArenaAllocator* tempAlloc) { SortFloats(elements, length); }
+    }
+
+    template<typename T> void TypedArraySortElements(T* elements, uint32 length, ArenaAllocator* tempAlloc)
+    {
+        TypedArraySort::Sort(elements, length, tempAlloc);
+    }
+
     Var TypedArrayBase::EntrySort(RecyclableObject* function, CallInfo callInfo, ...)
     {
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
@@ -2707,6 +2945,18 @@ namespace Js
             compareFn = RecyclableObject::FromVar(args[1]);
         }
 
+        if (compareFn == nullptr)
+        {
+            // Without a comparator the order only depends on the element type, so sort natively
+            BEGIN_TEMP_ALLOCATOR(tempAlloc, scriptContext, _u("Runtime"))
+            {
+                typedArrayBase->SortElements(tempAlloc);
+            }
+            END_TEMP_ALLOCATOR(tempAlloc, scriptContext);
+
+            return typedArrayBase;
+        }
+
         // Get the elements comparison function for the type of this TypedArray
         void* elementCompare = reinterpret_cast<void*>(typedArrayBase->GetCompareElementsFunction());
 
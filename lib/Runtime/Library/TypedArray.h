@@ -11,6 +11,7 @@ namespace Js
     typedef Var (*PFNCreateTypedArray)(Js::ArrayBuffer* arrayBuffer, uint32 offSet, uint32 mappedLength, Js::JavascriptLibrary* javascriptLibrary);
 
     template<typename T> int __cdecl TypedArrayCompareElementsHelper(void* context, const void* elem1, const void* elem2);
+    template<typename T> void TypedArraySortElements(T* elements, uint32 length, ArenaAllocator* tempAlloc);
 
     class TypedArrayBase : public ArrayBufferParent
     {
@@ -175,6 +176,8 @@ namespace Js
 
         typedef int(__cdecl* CompareElementsFunction)(void*, const void*, const void*);
         virtual CompareElementsFunction GetCompareElementsFunction() = 0;
+        // Sorts the elements in the default order, for sort() without a comparator
+        virtual void SortElements(ArenaAllocator* tempAlloc) = 0;
 
         virtual Var Subarray(uint32 begin, uint32 end) = 0;
         int32 BYTES_PER_ELEMENT;
@@ -419,6 +422,11 @@ namespace Js
         {
             return &TypedArrayCompareElementsHelper<TypeName>;
         }
+
+        void SortElements(ArenaAllocator* tempAlloc)
+        {
+            TypedArraySortElements<TypeName>(reinterpret_cast<TypeName*>(buffer), GetLength(), tempAlloc);
+        }
     };
 
     // in windows build environment, char16 is not an intrinsic type, and we cannot do the type
@@ -465,6 +473,12 @@ namespace Js
         {
             return &TypedArrayCompareElementsHelper<char16>;
         }
+
+        void SortElements(ArenaAllocator* tempAlloc)
+        {
+            // char16 orders like the unsigned 16-bit code unit it holds
+            TypedArraySortElements<uint16>(reinterpret_cast<uint16*>(buffer), GetLength(), tempAlloc);
+        }
     };
 
     typedef TypedArray<int8> Int8Array;
@@ -472,6 +472,7 @@ enum tagDEBUG_EVENT_INFO_TYPE
 #include "Library/GlobalObject.h"
 
 #include "Library/LiteralString.h"
+#include "Library/Latin1String.h"
 #include "Library/ConcatString.h"
 #include "Library/CompoundString.h"
 #include "Library/PropertyString.h"
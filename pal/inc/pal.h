@@ -3559,6 +3559,7 @@ SetErrorMode(
 #define MEM_MAPPED                      0x40000
 #define MEM_TOP_DOWN                    0x100000
 #define MEM_WRITE_WATCH                 0x200000
+#define MEM_LARGE_PAGES                 0x20000000 // reserve at a huge page boundary and back with transparent huge pages
 #define MEM_RESERVE_EXECUTABLE          0x40000000 // reserve memory using executable memory allocator
 
 PALIMPORT
@@ -3882,6 +3883,13 @@ VirtualQuery(
          OUT PMEMORY_BASIC_INFORMATION lpBuffer,
          IN SIZE_T dwLength);
 
+PALIMPORT
+BOOL
+PALAPI
+PAL_VirtualZeroMemory(
+         IN LPVOID lpAddress,
+         IN SIZE_T dwSize);
+
 PALIMPORT
 BOOL
 PALAPI
@@ -5837,6 +5845,8 @@ RtlCaptureContext(
   OUT PCONTEXT ContextRecord
 );
 
+#define WRITE_WATCH_FLAG_RESET          0x01
+
 PALIMPORT
 UINT
 PALAPI
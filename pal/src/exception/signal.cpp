@@ -41,6 +41,7 @@ Abstract:
 #include <unistd.h>
 
 #include "pal/context.h"
+#include "pal/virtual.h"
 
 using namespace CorUnix;
 
@@ -269,6 +270,13 @@ Parameters :
 --*/
 static void sigsegv_handler(int code, siginfo_t *siginfo, void *context)
 {
+    // Writes to write protected pages of MEM_WRITE_WATCH regions are expected,
+    // record them and restart the faulting instruction
+    if (siginfo->si_code == SEGV_ACCERR && VIRTUALHandleWriteWatchFault(siginfo->si_addr))
+    {
+        return;
+    }
+
     if (PALIsInitialized())
     {
         EXCEPTION_RECORD record;
@@ -30,6 +30,7 @@ Abstract:
 #include "pal/file.h"
 #include "pal/filetime.h"
 #include "pal/utils.h"
+#include "pal/virtual.h"
 
 #include <time.h>
 #include <stdio.h>
@@ -2417,6 +2418,7 @@ CorUnix::InternalReadFile(
 
 Read:
     TRACE("Reading from file descriptor %d\n", ifd);
+    VIRTUALWriteWatchDirtyRange(lpBuffer, nNumberOfBytesToRead);
     res = read(ifd, lpBuffer, nNumberOfBytesToRead);
     TRACE("read() returns %d\n", res);
 
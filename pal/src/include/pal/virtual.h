@@ -69,7 +69,8 @@ enum VIRTUAL_CONSTANTS
     VIRTUAL_PAGE_SIZE       = 0x1000,
 #endif  // __sparc__
     VIRTUAL_PAGE_MASK       = VIRTUAL_PAGE_SIZE - 1,
-    BOUNDARY_64K    = 0xffff
+    BOUNDARY_64K    = 0xffff,
+    VIRTUAL_HUGE_PAGE_SIZE  = 0x200000      /* Transparent huge page size, see MEM_LARGE_PAGES */
 };
 
 /*++
@@ -102,6 +103,26 @@ Function :
 --*/
 BOOL VIRTUALOwnedRegion( IN UINT_PTR address );
 
+/*++
+Function :
+    VIRTUALHandleWriteWatchFault
+
+    Records the first write to a page of a MEM_WRITE_WATCH region and
+    restores write access to it. Called from the SIGSEGV handler.
+
+    Returns TRUE if the fault was caused by the write watch emulation.
+--*/
+BOOL VIRTUALHandleWriteWatchFault( IN LPVOID address );
+
+/*++
+Function :
+    VIRTUALWriteWatchDirtyRange
+
+    Records the pages of MEM_WRITE_WATCH regions in a range as written to and
+    makes them writable. Called before the kernel writes into a buffer.
+--*/
+void VIRTUALWriteWatchDirtyRange( IN LPVOID lpAddress, IN SIZE_T dwSize );
+
 
 #ifdef __cplusplus
 }
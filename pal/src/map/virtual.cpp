@@ -105,6 +105,17 @@ static LPVOID ReserveVirtualMemory(
                 IN LPVOID lpAddress,        /* Region to reserve or commit */
                 IN SIZE_T dwSize);          /* Size of Region */
 
+static LPVOID VIRTUALReserveHugePageMemory(
+                IN CPalThread *pthrCurrent, /* Currently executing thread */
+                IN SIZE_T dwSize);          /* Size of Region */
+
+static void VIRTUALAdviseHugePages(
+                IN PCMI pInformation,       /* Region the range belongs to */
+                IN UINT_PTR StartBoundary,  /* Start of the range */
+                IN SIZE_T MemSize);         /* Size of the range */
+
+
+static BOOL VIRTUALAddWriteWatchRegion( IN UINT_PTR startBoundary, IN SIZE_T memSize );
 
 // A memory allocator that allocates memory from a pre-reserved region
 // of virtual memory that is located near the coreclr library.
@@ -938,6 +949,11 @@ static LPVOID VIRTUALReserveMemory(
         pRetVal = g_executableMemoryAllocator.AllocateMemory(MemSize);
     }
 
+    if (((flAllocationType & MEM_LARGE_PAGES) != 0) && (lpAddress == NULL))
+    {
+        pRetVal = VIRTUALReserveHugePageMemory(pthrCurrent, MemSize);
+    }
+
     if (pRetVal == NULL)
     {
         // Try to reserve memory from the OS
@@ -965,6 +981,14 @@ static LPVOID VIRTUALReserveMemory(
             munmap( pRetVal, MemSize );
             pRetVal = NULL;
         }
+        else if ( ( flAllocationType & MEM_WRITE_WATCH ) &&
+                  !VIRTUALAddWriteWatchRegion( StartBoundary, MemSize ) )
+        {
+            VIRTUALReleaseMemory( VIRTUALFindRegionInformation( StartBoundary ) );
+            pthrCurrent->SetLastError( ERROR_NOT_ENOUGH_MEMORY );
+            munmap( pRetVal, MemSize );
+            pRetVal = NULL;
+        }
     }
 
     InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
@@ -1064,6 +1088,111 @@ done:
     return pRetVal;
 }
 
+/* The unused tail of the last huge page reservation, see VIRTUALReserveHugePageMemory.
+   Protected by virtual_critsec. */
+static char * pHugePageSlabTail PAL_GLOBAL = NULL;
+static SIZE_T hugePageSlabTailSize PAL_GLOBAL = 0;
+
+/******
+ *
+ *  VIRTUALReserveHugePageMemory() - Reserves memory inside a run of huge
+ *  pages that starts at a huge page boundary and asks for it to be backed by
+ *  transparent huge pages.
+ *
+ *  Reservations smaller than a huge page are carved out of the same run one
+ *  after the other, so that e.g. two 1MB reservations share one huge page.
+ *  Each of them is still its own region, released on its own.
+ *
+ *  Returns NULL if huge pages aren't supported here or the reservation failed;
+ *  the caller then falls back to an ordinary reservation.
+ *
+ */
+static LPVOID VIRTUALReserveHugePageMemory(
+                IN CPalThread *pthrCurrent, /* Currently executing thread */
+                IN SIZE_T dwSize)           /* Size of Region */
+{
+#if defined(__LINUX__) && !RESERVE_FROM_BACKING_FILE && !HAVE_VM_ALLOCATE && !MMAP_IGNORES_HINT
+    char * pStart;
+
+    if (dwSize <= hugePageSlabTailSize)
+    {
+        pStart = pHugePageSlabTail;
+    }
+    else
+    {
+        // Give back what is left of the previous run; it is too small.
+        if (pHugePageSlabTail != NULL)
+        {
+            munmap(pHugePageSlabTail, hugePageSlabTailSize);
+            pHugePageSlabTail = NULL;
+            hugePageSlabTailSize = 0;
+        }
+
+        // Over-reserve by a huge page so that an aligned start is guaranteed,
+        // then give back the slack on either side.
+        SIZE_T slabSize = (dwSize + VIRTUAL_HUGE_PAGE_SIZE - 1) & ~((SIZE_T)VIRTUAL_HUGE_PAGE_SIZE - 1);
+        SIZE_T reserveSize = slabSize + VIRTUAL_HUGE_PAGE_SIZE;
+        char * pReserved = (char *)mmap(NULL, reserveSize, PROT_NONE, MAP_ANON | MAP_PRIVATE, -1, 0);
+        if (pReserved == MAP_FAILED)
+        {
+            WARN( "Unable to reserve %u bytes for huge pages, errno = %d.\n", reserveSize, errno );
+            return NULL;
+        }
+
+        pStart = (char *)(((UINT_PTR)pReserved + VIRTUAL_HUGE_PAGE_SIZE - 1) & ~((UINT_PTR)VIRTUAL_HUGE_PAGE_SIZE - 1));
+        char * pEnd = pStart + slabSize;
+        if (pStart != pReserved)
+        {
+            munmap(pReserved, pStart - pReserved);
+        }
+        if (pEnd != pReserved + reserveSize)
+        {
+            munmap(pEnd, (pReserved + reserveSize) - pEnd);
+        }
+
+#ifdef MADV_HUGEPAGE
+        if (madvise(pStart, slabSize, MADV_HUGEPAGE) != 0)
+        {
+            // Still a usable reservation; it just won't be backed by huge pages.
+            WARN( "madvise(MADV_HUGEPAGE) failed, errno = %d.\n", errno );
+        }
+#endif
+        pHugePageSlabTail = pStart;
+        hugePageSlabTailSize = slabSize;
+    }
+
+    pHugePageSlabTail += dwSize;
+    hugePageSlabTailSize -= dwSize;
+    if (hugePageSlabTailSize == 0)
+    {
+        pHugePageSlabTail = NULL;
+    }
+    return pStart;
+#else
+    return NULL;
+#endif
+}
+
+/******
+ *
+ *  VIRTUALAdviseHugePages() - Commit and decommit map fresh pages over the
+ *  range, which drops the huge page advice; put it back for MEM_LARGE_PAGES
+ *  regions.
+ *
+ */
+static void VIRTUALAdviseHugePages(
+                IN PCMI pInformation,       /* Region the range belongs to */
+                IN UINT_PTR StartBoundary,  /* Start of the range */
+                IN SIZE_T MemSize)          /* Size of the range */
+{
+#if defined(__LINUX__) && defined(MADV_HUGEPAGE)
+    if ((pInformation->allocationType & MEM_LARGE_PAGES) != 0)
+    {
+        madvise((LPVOID)StartBoundary, MemSize, MADV_HUGEPAGE);
+    }
+#endif
+}
+
 /******
  *
  *  VIRTUALCommitMemory() - Helper function that actually commits the memory.
@@ -1230,6 +1359,7 @@ static LPVOID VIRTUALCommitMemory(
                 ERROR("mmap() failed! Error(%d)=%s\n", errno, strerror(errno));
                 goto error;
             }
+            VIRTUALAdviseHugePages(pInformation, StartBoundary, MemSize);
             VIRTUALSetAllocState(MEM_COMMIT, runStart, runLength, pInformation);
 #if MMAP_DOESNOT_ALLOW_REMAP
             VIRTUALSetDirtyPages (0, runStart, runLength, pInformation);
@@ -1608,13 +1738,481 @@ done:
 }
 #endif // RESERVE_FROM_BACKING_FILE
 
+/*++
+Write watch support
+
+    Windows tracks writes to MEM_WRITE_WATCH regions in the memory manager.
+    There is no equivalent on Unix, so we emulate it in software: committed
+    read/write pages of a watched region are kept read-only until they are
+    first written to. The resulting SIGSEGV is resolved by
+    VIRTUALHandleWriteWatchFault, which records the page as dirty and restores
+    write access. Resetting the write watch makes the pages read-only again.
+
+    The write watch state is kept separately from the CMI list since it has
+    to be accessed from the signal handler, where virtual_critsec cannot be
+    taken. It is protected by a spin lock instead, which is never held while
+    writing to watched memory; a write watch fault taken by the thread that
+    holds the lock is a PAL bug and aborts the process instead of deadlocking.
+
+    Only pages committed as PAGE_READWRITE are tracked. Writes done by the
+    kernel on behalf of a system call (e.g. read() into a watched buffer) do
+    not raise SIGSEGV and would fail with EFAULT, so PAL functions that have
+    the kernel write into a caller's buffer first call
+    VIRTUALWriteWatchDirtyRange on it.
+--*/
+
+typedef struct _WRITE_WATCH_REGION {
+    UINT_PTR startBoundary;     /* Starting location of the region. */
+    SIZE_T   memSize;           /* Size of the entire region. */
+    BYTE *   pPageState;        /* WRITE_WATCH_PAGE_STATE for each page. */
+} WRITE_WATCH_REGION, * PWRITE_WATCH_REGION;
+
+enum WRITE_WATCH_PAGE_STATE
+{
+    WRITE_WATCH_UNTRACKED = 0,  /* Not committed, or not read/write. */
+    WRITE_WATCH_CLEAN,          /* Read-only until the next write. */
+    WRITE_WATCH_DIRTY           /* Written to since the last reset. */
+};
+
+/* Watched regions, sorted by start address so that lookups (including the
+   one done by the SIGSEGV handler) are a binary search. */
+static PWRITE_WATCH_REGION * pWriteWatchIndex PAL_GLOBAL = NULL;
+static SIZE_T writeWatchRegionCount PAL_GLOBAL = 0;
+static SIZE_T writeWatchIndexCapacity PAL_GLOBAL = 0;
+static PWRITE_WATCH_REGION pLastWriteWatchRegion PAL_GLOBAL = NULL;
+/* Thread id of the owner of the write watch lock, 0 when it is free. */
+static volatile SIZE_T writeWatchLockOwner PAL_GLOBAL = 0;
+
+static void VIRTUALAcquireWriteWatchLock()
+{
+    SIZE_T self = THREADSilentGetCurrentThreadId();
+    while (!__sync_bool_compare_and_swap(&writeWatchLockOwner, 0, self))
+    {
+        while (writeWatchLockOwner != 0)
+        {
+#if defined(__i386__) || defined(__x86_64__)
+            __builtin_ia32_pause();
+#endif
+        }
+    }
+}
+
+static void VIRTUALReleaseWriteWatchLock()
+{
+    __sync_lock_release(&writeWatchLockOwner);
+}
+
+/*++
+Function :
+    VIRTUALLowerBoundWriteWatchRegion
+
+    Returns the index of the first watched region starting above address.
+    The write watch lock must be held.
+--*/
+static SIZE_T VIRTUALLowerBoundWriteWatchRegion( IN UINT_PTR address )
+{
+    SIZE_T low = 0;
+    SIZE_T high = writeWatchRegionCount;
+
+    while ( low < high )
+    {
+        SIZE_T mid = low + ( high - low ) / 2;
+        if ( pWriteWatchIndex[ mid ]->startBoundary <= address )
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+/*++
+Function :
+    VIRTUALFindWriteWatchRegion
+
+    Returns the watched region containing address, NULL if there is none.
+    The write watch lock must be held.
+--*/
+static PWRITE_WATCH_REGION VIRTUALFindWriteWatchRegion( IN UINT_PTR address )
+{
+    PWRITE_WATCH_REGION pRegion = pLastWriteWatchRegion;
+
+    if ( pRegion != NULL &&
+         address >= pRegion->startBoundary &&
+         address < pRegion->startBoundary + pRegion->memSize )
+    {
+        return pRegion;
+    }
+
+    SIZE_T index = VIRTUALLowerBoundWriteWatchRegion( address );
+    if ( index == 0 )
+    {
+        return NULL;
+    }
+
+    pRegion = pWriteWatchIndex[ index - 1 ];
+    if ( address >= pRegion->startBoundary + pRegion->memSize )
+    {
+        return NULL;
+    }
+    pLastWriteWatchRegion = pRegion;
+    return pRegion;
+}
+
+/*++
+Function :
+    VIRTUALAddWriteWatchRegion
+
+    Starts tracking writes to a newly reserved region.
+--*/
+static BOOL VIRTUALAddWriteWatchRegion( IN UINT_PTR startBoundary, IN SIZE_T memSize )
+{
+    PWRITE_WATCH_REGION pRegion = (PWRITE_WATCH_REGION)InternalMalloc( sizeof( *pRegion ) );
+    if ( pRegion == NULL )
+    {
+        ERROR( "Unable to allocate memory for the write watch structure.\n" );
+        return FALSE;
+    }
+
+    pRegion->pPageState = (BYTE *)InternalMalloc( memSize / VIRTUAL_PAGE_SIZE );
+    if ( pRegion->pPageState == NULL )
+    {
+        ERROR( "Unable to allocate memory for the write watch page state.\n" );
+        InternalFree( pRegion );
+        return FALSE;
+    }
+    memset( pRegion->pPageState, WRITE_WATCH_UNTRACKED, memSize / VIRTUAL_PAGE_SIZE );
+    pRegion->startBoundary = startBoundary;
+    pRegion->memSize = memSize;
+
+    VIRTUALAcquireWriteWatchLock();
+    while ( writeWatchRegionCount == writeWatchIndexCapacity )
+    {
+        // Grow the index without holding the lock, the signal handler may
+        // need it while we are in the allocator.
+        SIZE_T newCapacity = writeWatchIndexCapacity == 0 ? 64 : writeWatchIndexCapacity * 2;
+        VIRTUALReleaseWriteWatchLock();
+
+        PWRITE_WATCH_REGION * pNewIndex =
+            (PWRITE_WATCH_REGION *)InternalMalloc( newCapacity * sizeof( PWRITE_WATCH_REGION ) );
+        if ( pNewIndex == NULL )
+        {
+            ERROR( "Unable to allocate memory for the write watch index.\n" );
+            InternalFree( pRegion->pPageState );
+            InternalFree( pRegion );
+            return FALSE;
+        }
+
+        PWRITE_WATCH_REGION * pOldIndex = pNewIndex;
+        VIRTUALAcquireWriteWatchLock();
+        if ( newCapacity > writeWatchIndexCapacity )
+        {
+            if ( writeWatchRegionCount != 0 )
+            {
+                memcpy( pNewIndex, pWriteWatchIndex, writeWatchRegionCount * sizeof( PWRITE_WATCH_REGION ) );
+            }
+            pOldIndex = pWriteWatchIndex;
+            pWriteWatchIndex = pNewIndex;
+            writeWatchIndexCapacity = newCapacity;
+        }
+
+        if ( pOldIndex != NULL )
+        {
+            // Either the replaced index or ours if another thread grew it first
+            VIRTUALReleaseWriteWatchLock();
+            InternalFree( pOldIndex );
+            VIRTUALAcquireWriteWatchLock();
+        }
+    }
+
+    SIZE_T index = VIRTUALLowerBoundWriteWatchRegion( startBoundary );
+    memmove( pWriteWatchIndex + index + 1, pWriteWatchIndex + index,
+             ( writeWatchRegionCount - index ) * sizeof( PWRITE_WATCH_REGION ) );
+    pWriteWatchIndex[ index ] = pRegion;
+    writeWatchRegionCount++;
+    VIRTUALReleaseWriteWatchLock();
+    return TRUE;
+}
+
+/*++
+Function :
+    VIRTUALRemoveWriteWatchRegion
+
+    Stops tracking writes to a region that is being released.
+--*/
+static void VIRTUALRemoveWriteWatchRegion( IN UINT_PTR startBoundary )
+{
+    PWRITE_WATCH_REGION pRegion = NULL;
+
+    VIRTUALAcquireWriteWatchLock();
+    SIZE_T index = VIRTUALLowerBoundWriteWatchRegion( startBoundary );
+    if ( index != 0 && pWriteWatchIndex[ index - 1 ]->startBoundary == startBoundary )
+    {
+        pRegion = pWriteWatchIndex[ index - 1 ];
+        memmove( pWriteWatchIndex + index - 1, pWriteWatchIndex + index,
+                 ( writeWatchRegionCount - index ) * sizeof( PWRITE_WATCH_REGION ) );
+        writeWatchRegionCount--;
+    }
+    if ( pLastWriteWatchRegion == pRegion )
+    {
+        pLastWriteWatchRegion = NULL;
+    }
+    VIRTUALReleaseWriteWatchLock();
+
+    if ( pRegion != NULL )
+    {
+        InternalFree( pRegion->pPageState );
+        InternalFree( pRegion );
+    }
+}
+
+/*++
+Function :
+    VIRTUALProtectCleanPages
+
+    Write protects the clean pages in a run of pages so that the next write
+    to them is recorded. The write watch lock must be held.
+--*/
+static BOOL VIRTUALProtectCleanPages( IN PWRITE_WATCH_REGION pRegion,
+                                      IN SIZE_T index, IN SIZE_T count )
+{
+    SIZE_T runStart = index;
+    SIZE_T end = index + count;
+    BOOL bRetVal = TRUE;
+
+    while ( runStart < end )
+    {
+        if ( pRegion->pPageState[ runStart ] != WRITE_WATCH_CLEAN )
+        {
+            runStart++;
+            continue;
+        }
+
+        SIZE_T runEnd = runStart + 1;
+        while ( runEnd < end && pRegion->pPageState[ runEnd ] == WRITE_WATCH_CLEAN )
+        {
+            runEnd++;
+        }
+
+        if ( mprotect( (LPVOID)( pRegion->startBoundary + runStart * VIRTUAL_PAGE_SIZE ),
+                       ( runEnd - runStart ) * VIRTUAL_PAGE_SIZE, PROT_READ ) != 0 )
+        {
+            ERROR( "mprotect failed to write protect watched pages: %s\n", strerror( errno ) );
+
+            // The pages may still be writable, conservatively report them as written
+            memset( pRegion->pPageState + runStart, WRITE_WATCH_DIRTY, runEnd - runStart );
+            bRetVal = FALSE;
+        }
+        runStart = runEnd;
+    }
+    return bRetVal;
+}
+
+/*++
+Function :
+    VIRTUALResetWriteWatchPages
+
+    Marks a run of tracked pages as clean. Each contiguous run of tracked
+    pages that has been written to is write protected with a single mprotect;
+    runs that are still clean are already read-only and are left alone.
+    The write watch lock must be held.
+--*/
+static BOOL VIRTUALResetWriteWatchPages( IN PWRITE_WATCH_REGION pRegion,
+                                         IN SIZE_T index, IN SIZE_T count )
+{
+    SIZE_T runStart = index;
+    SIZE_T end = index + count;
+    BOOL bRetVal = TRUE;
+
+    while ( runStart < end )
+    {
+        if ( pRegion->pPageState[ runStart ] == WRITE_WATCH_UNTRACKED )
+        {
+            runStart++;
+            continue;
+        }
+
+        BOOL bDirty = FALSE;
+        SIZE_T runEnd = runStart;
+        while ( runEnd < end && pRegion->pPageState[ runEnd ] != WRITE_WATCH_UNTRACKED )
+        {
+            bDirty |= ( pRegion->pPageState[ runEnd ] == WRITE_WATCH_DIRTY );
+            pRegion->pPageState[ runEnd ] = WRITE_WATCH_CLEAN;
+            runEnd++;
+        }
+
+        if ( bDirty && !VIRTUALProtectCleanPages( pRegion, runStart, runEnd - runStart ) )
+        {
+            bRetVal = FALSE;
+        }
+        runStart = runEnd;
+    }
+    return bRetVal;
+}
+
+/*++
+Function :
+    VIRTUALWriteWatchCommit
+
+    Called after pages have been committed. Pages of a watched region that
+    were committed read/write start out clean.
+--*/
+static void VIRTUALWriteWatchCommit( IN LPVOID lpAddress, IN SIZE_T dwSize, IN DWORD flProtect )
+{
+    UINT_PTR StartBoundary = (UINT_PTR)lpAddress & ~VIRTUAL_PAGE_MASK;
+    SIZE_T MemSize = ( ((UINT_PTR)lpAddress + dwSize + VIRTUAL_PAGE_MASK) & ~VIRTUAL_PAGE_MASK ) -
+                     StartBoundary;
+
+    VIRTUALAcquireWriteWatchLock();
+    PWRITE_WATCH_REGION pRegion = VIRTUALFindWriteWatchRegion( StartBoundary );
+    if ( pRegion != NULL )
+    {
+        SIZE_T index = ( StartBoundary - pRegion->startBoundary ) / VIRTUAL_PAGE_SIZE;
+        SIZE_T count = min( MemSize / VIRTUAL_PAGE_SIZE, pRegion->memSize / VIRTUAL_PAGE_SIZE - index );
+
+        if ( ( flProtect & 0xff ) != PAGE_READWRITE )
+        {
+            memset( pRegion->pPageState + index, WRITE_WATCH_UNTRACKED, count );
+        }
+        else
+        {
+            // Re-committing a page that has already been written to must not
+            // lose its write watch state, but the commit made it writable again.
+            for ( SIZE_T i = index; i < index + count; i++ )
+            {
+                if ( pRegion->pPageState[ i ] != WRITE_WATCH_DIRTY )
+                {
+                    pRegion->pPageState[ i ] = WRITE_WATCH_CLEAN;
+                }
+            }
+            VIRTUALProtectCleanPages( pRegion, index, count );
+        }
+    }
+    VIRTUALReleaseWriteWatchLock();
+}
+
+/*++
+Function :
+    VIRTUALWriteWatchChangeState
+
+    Called before pages of a watched region are decommitted or have their
+    protection changed. Pages that remain read/write are conservatively
+    reported as written.
+--*/
+static void VIRTUALWriteWatchChangeState( IN UINT_PTR StartBoundary, IN SIZE_T MemSize, IN BOOL bWritable )
+{
+    VIRTUALAcquireWriteWatchLock();
+    PWRITE_WATCH_REGION pRegion = VIRTUALFindWriteWatchRegion( StartBoundary );
+    if ( pRegion != NULL )
+    {
+        SIZE_T index = ( StartBoundary - pRegion->startBoundary ) / VIRTUAL_PAGE_SIZE;
+        SIZE_T count = min( MemSize / VIRTUAL_PAGE_SIZE, pRegion->memSize / VIRTUAL_PAGE_SIZE - index );
+        memset( pRegion->pPageState + index,
+                bWritable ? WRITE_WATCH_DIRTY : WRITE_WATCH_UNTRACKED, count );
+    }
+    VIRTUALReleaseWriteWatchLock();
+}
+
+/*++
+Function :
+    VIRTUALHandleWriteWatchFault
+
+    Called from the SIGSEGV handler. If the fault is the first write to a
+    clean page of a watched region, the page is recorded as dirty and made
+    writable again so that the faulting instruction can be restarted.
+
+    Returns TRUE if the fault was handled.
+--*/
+BOOL VIRTUALHandleWriteWatchFault( IN LPVOID address )
+{
+    BOOL bHandled = FALSE;
+
+    if ( writeWatchRegionCount == 0 )
+    {
+        return FALSE;
+    }
+
+    // Spinning here would never end if this thread faulted while holding the lock
+    if ( writeWatchLockOwner == THREADSilentGetCurrentThreadId() )
+    {
+        ASSERT( "Write watch fault at %p while holding the write watch lock\n", address );
+        abort();
+    }
+
+    VIRTUALAcquireWriteWatchLock();
+    PWRITE_WATCH_REGION pRegion = VIRTUALFindWriteWatchRegion( (UINT_PTR)address );
+    if ( pRegion != NULL )
+    {
+        UINT_PTR pageStart = (UINT_PTR)address & ~VIRTUAL_PAGE_MASK;
+        SIZE_T index = ( pageStart - pRegion->startBoundary ) / VIRTUAL_PAGE_SIZE;
+
+        // A dirty page may still fault if another thread raced us to handle
+        // the same page; the write will succeed when the instruction restarts.
+        if ( pRegion->pPageState[ index ] != WRITE_WATCH_UNTRACKED &&
+             mprotect( (LPVOID)pageStart, VIRTUAL_PAGE_SIZE, PROT_READ | PROT_WRITE ) == 0 )
+        {
+            pRegion->pPageState[ index ] = WRITE_WATCH_DIRTY;
+            bHandled = TRUE;
+        }
+    }
+    VIRTUALReleaseWriteWatchLock();
+    return bHandled;
+}
+
+/*++
+Function :
+    VIRTUALWriteWatchDirtyRange
+
+    Records the clean pages of watched regions in a range as written to and
+    makes them writable, so that the kernel can write to them on behalf of a
+    system call without failing with EFAULT.
+--*/
+void VIRTUALWriteWatchDirtyRange( IN LPVOID lpAddress, IN SIZE_T dwSize )
+{
+    if ( writeWatchRegionCount == 0 || dwSize == 0 )
+    {
+        return;
+    }
+
+    UINT_PTR pageStart = (UINT_PTR)lpAddress & ~VIRTUAL_PAGE_MASK;
+    UINT_PTR end = ( (UINT_PTR)lpAddress + dwSize + VIRTUAL_PAGE_MASK ) & ~VIRTUAL_PAGE_MASK;
+
+    VIRTUALAcquireWriteWatchLock();
+    for ( ; pageStart < end; pageStart += VIRTUAL_PAGE_SIZE )
+    {
+        PWRITE_WATCH_REGION pRegion = VIRTUALFindWriteWatchRegion( pageStart );
+        if ( pRegion == NULL )
+        {
+            continue;
+        }
+
+        SIZE_T index = ( pageStart - pRegion->startBoundary ) / VIRTUAL_PAGE_SIZE;
+        if ( pRegion->pPageState[ index ] == WRITE_WATCH_CLEAN &&
+             mprotect( (LPVOID)pageStart, VIRTUAL_PAGE_SIZE, PROT_READ | PROT_WRITE ) == 0 )
+        {
+            pRegion->pPageState[ index ] = WRITE_WATCH_DIRTY;
+        }
+    }
+    VIRTUALReleaseWriteWatchLock();
+}
+
 /*++
 Function:
   VirtualAlloc
 
 Note:
-  MEM_TOP_DOWN, MEM_PHYSICAL, MEM_WRITE_WATCH are not supported.
+  MEM_TOP_DOWN, MEM_PHYSICAL are not supported.
   Unsupported flags are ignored.
+
+  MEM_WRITE_WATCH is emulated in software, see VIRTUALHandleWriteWatchFault.
+
+  MEM_LARGE_PAGES doesn't need any privilege here: a reservation made at a
+  system chosen address is placed in a 2MB aligned run that is advised to use
+  transparent huge pages, shared with the next such reservations if it is
+  smaller than 2MB (Linux only; ignored elsewhere).
   
   Page size on i386 is set to 4k.
 
@@ -1637,17 +2235,19 @@ VirtualAlloc(
 
     pthrCurrent = InternalGetCurrentThread();
 
-    if ( ( flAllocationType & MEM_WRITE_WATCH )  != 0 )
+    if ( ( flAllocationType & MEM_WRITE_WATCH )  != 0 &&
+         ( flAllocationType & MEM_RESERVE ) == 0 )
     {
+        ERROR( "MEM_WRITE_WATCH can only be specified when reserving memory.\n" );
         pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
         goto done;
     }
 
     /* Test for un-supported flags. */
-    if ( ( flAllocationType & ~( MEM_COMMIT | MEM_RESERVE | MEM_TOP_DOWN | MEM_RESERVE_EXECUTABLE ) ) != 0 )
+    if ( ( flAllocationType & ~( MEM_COMMIT | MEM_RESERVE | MEM_TOP_DOWN | MEM_RESERVE_EXECUTABLE | MEM_WRITE_WATCH | MEM_LARGE_PAGES ) ) != 0 )
     {
         ASSERT( "flAllocationType can be one, or any combination of MEM_COMMIT, \
-               MEM_RESERVE, MEM_TOP_DOWN, or MEM_RESERVE_EXECUTABLE.\n" );
+               MEM_RESERVE, MEM_TOP_DOWN, MEM_RESERVE_EXECUTABLE, MEM_WRITE_WATCH, or MEM_LARGE_PAGES.\n" );
         pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
         goto done;
     }
@@ -1697,6 +2297,10 @@ VirtualAlloc(
             pRetVal = VIRTUALCommitMemory( pthrCurrent, lpAddress, dwSize, 
                                     flAllocationType, flProtect );
         }
+        if ( pRetVal != NULL )
+        {
+            VIRTUALWriteWatchCommit( pRetVal, dwSize, flProtect );
+        }
         InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
     }                      
     
@@ -1794,6 +2398,8 @@ VirtualFree(
         TRACE( "Un-committing the following page(s) %d to %d.\n", 
                StartBoundary, MemSize );
 
+        VIRTUALWriteWatchChangeState( StartBoundary, MemSize, FALSE );
+
 #if MMAP_DOESNOT_ALLOW_REMAP
         // if no double mapping is supported, 
         // just mprotect the memory with no access
@@ -1871,6 +2477,8 @@ VirtualFree(
 
         TRACE( "Releasing the following memory %d to %d.\n", 
                pMemoryToBeReleased->startBoundary, pMemoryToBeReleased->memSize );
+
+        VIRTUALRemoveWriteWatchRegion( pMemoryToBeReleased->startBoundary );
         
 #if (MMAP_IGNORES_HINT && !MMAP_DOESNOT_ALLOW_REMAP)
         if (mmap((void *) pMemoryToBeReleased->startBoundary,
@@ -1989,6 +2597,9 @@ VirtualProtect(
         }
     }
 
+    VIRTUALWriteWatchChangeState( StartBoundary, MemSize,
+                                  ( flNewProtect & 0xff ) == PAGE_READWRITE );
+
     if ( 0 == mprotect( (LPVOID)StartBoundary, MemSize, 
                    W32toUnixAccessControl( flNewProtect ) ) )
     {
@@ -2328,11 +2939,70 @@ GetWriteWatch(
   OUT PULONG lpdwGranularity
 )
 {
-    // TODO: implement this method
-    *lpAddresses = NULL;
-    *lpdwCount = 0;
-    // Until it is implemented, return non-zero value as an indicator of failure
-    return 1;
+    UINT uRetVal = (UINT)-1;
+    UINT_PTR StartBoundary;
+    SIZE_T MemSize;
+    PWRITE_WATCH_REGION pRegion;
+
+    ENTRY("GetWriteWatch(dwFlags=%#x, lpBaseAddress=%p, dwRegionSize=%u, "
+          "lpAddresses=%p, lpdwCount=%p, lpdwGranularity=%p)\n",
+          dwFlags, lpBaseAddress, dwRegionSize, lpAddresses, lpdwCount, lpdwGranularity);
+
+    if ( ( dwFlags & ~WRITE_WATCH_FLAG_RESET ) != 0 || lpAddresses == NULL ||
+         lpdwCount == NULL || lpdwGranularity == NULL )
+    {
+        SetLastError( ERROR_INVALID_PARAMETER );
+        goto ExitGetWriteWatch;
+    }
+
+    StartBoundary = (UINT_PTR)lpBaseAddress & ~VIRTUAL_PAGE_MASK;
+    MemSize = ( ((UINT_PTR)lpBaseAddress + dwRegionSize + VIRTUAL_PAGE_MASK) & ~VIRTUAL_PAGE_MASK ) -
+              StartBoundary;
+
+    VIRTUALAcquireWriteWatchLock();
+    pRegion = VIRTUALFindWriteWatchRegion( StartBoundary );
+    if ( pRegion == NULL ||
+         StartBoundary + MemSize > pRegion->startBoundary + pRegion->memSize )
+    {
+        VIRTUALReleaseWriteWatchLock();
+        ERROR( "The range is not part of a single MEM_WRITE_WATCH region.\n" );
+        SetLastError( ERROR_INVALID_PARAMETER );
+        goto ExitGetWriteWatch;
+    }
+    else
+    {
+        SIZE_T index = ( StartBoundary - pRegion->startBoundary ) / VIRTUAL_PAGE_SIZE;
+        SIZE_T end = index + MemSize / VIRTUAL_PAGE_SIZE;
+        ULONG_PTR count = 0;
+
+        for ( ; index < end && count < *lpdwCount; index++ )
+        {
+            if ( pRegion->pPageState[ index ] == WRITE_WATCH_DIRTY )
+            {
+                lpAddresses[ count++ ] = (PVOID)( pRegion->startBoundary + index * VIRTUAL_PAGE_SIZE );
+                if ( dwFlags & WRITE_WATCH_FLAG_RESET )
+                {
+                    pRegion->pPageState[ index ] = WRITE_WATCH_CLEAN;
+                }
+            }
+        }
+
+        if ( dwFlags & WRITE_WATCH_FLAG_RESET )
+        {
+            // Pages that have been reported are now clean, write protect them again
+            SIZE_T first = ( StartBoundary - pRegion->startBoundary ) / VIRTUAL_PAGE_SIZE;
+            VIRTUALProtectCleanPages( pRegion, first, index - first );
+        }
+        VIRTUALReleaseWriteWatchLock();
+
+        *lpdwCount = count;
+        *lpdwGranularity = VIRTUAL_PAGE_SIZE;
+        uRetVal = 0;
+    }
+
+ExitGetWriteWatch:
+    LOGEXIT( "GetWriteWatch returning %u.\n", uRetVal );
+    return uRetVal;
 }
 
 /*++
@@ -2348,9 +3018,92 @@ ResetWriteWatch(
   IN SIZE_T dwRegionSize
 )
 {
-    // TODO: implement this method
-    // Until it is implemented, return non-zero value as an indicator of failure
-    return 1;
+    UINT uRetVal = (UINT)-1;
+    UINT_PTR StartBoundary;
+    SIZE_T MemSize;
+    PWRITE_WATCH_REGION pRegion;
+
+    ENTRY("ResetWriteWatch(lpBaseAddress=%p, dwRegionSize=%u)\n",
+          lpBaseAddress, dwRegionSize);
+
+    StartBoundary = (UINT_PTR)lpBaseAddress & ~VIRTUAL_PAGE_MASK;
+    MemSize = ( ((UINT_PTR)lpBaseAddress + dwRegionSize + VIRTUAL_PAGE_MASK) & ~VIRTUAL_PAGE_MASK ) -
+              StartBoundary;
+
+    VIRTUALAcquireWriteWatchLock();
+    pRegion = VIRTUALFindWriteWatchRegion( StartBoundary );
+    if ( pRegion == NULL ||
+         StartBoundary + MemSize > pRegion->startBoundary + pRegion->memSize )
+    {
+        ERROR( "The range is not part of a single MEM_WRITE_WATCH region.\n" );
+        SetLastError( ERROR_INVALID_PARAMETER );
+    }
+    else if ( VIRTUALResetWriteWatchPages( pRegion,
+                  ( StartBoundary - pRegion->startBoundary ) / VIRTUAL_PAGE_SIZE,
+                  MemSize / VIRTUAL_PAGE_SIZE ) )
+    {
+        uRetVal = 0;
+    }
+    else
+    {
+        SetLastError( ERROR_INTERNAL_ERROR );
+    }
+    VIRTUALReleaseWriteWatchLock();
+
+    LOGEXIT( "ResetWriteWatch returning %u.\n", uRetVal );
+    return uRetVal;
+}
+
+/*++
+Function:
+  PAL_VirtualZeroMemory
+
+  Zero-fills committed, page aligned memory by dropping its physical pages
+  with madvise(MADV_DONTNEED); the next touch maps in fresh zero pages. This
+  is much cheaper than a memset for large ranges and also returns the pages
+  to the OS. MADV_FREE is not used: it does not guarantee zero fill.
+
+  Returns FALSE if the range could not be discarded, in which case the
+  caller must clear it itself.
+--*/
+BOOL
+PALAPI
+PAL_VirtualZeroMemory(
+  IN LPVOID lpAddress,
+  IN SIZE_T dwSize
+)
+{
+    BOOL bRetVal = FALSE;
+
+    ENTRY("PAL_VirtualZeroMemory(lpAddress=%p, dwSize=%u)\n", lpAddress, dwSize);
+
+    if ( ((UINT_PTR)lpAddress & VIRTUAL_PAGE_MASK) != 0 ||
+         (dwSize & VIRTUAL_PAGE_MASK) != 0 || dwSize == 0 )
+    {
+        ERROR( "The range must be page aligned.\n" );
+        SetLastError( ERROR_INVALID_PARAMETER );
+        goto ExitVirtualZeroMemory;
+    }
+
+#if defined(__LINUX__) && !RESERVE_FROM_BACKING_FILE
+    // Only Linux guarantees that private anonymous pages read back as zero
+    // after MADV_DONTNEED; the protection and write watch state are kept.
+    if ( madvise( lpAddress, dwSize, MADV_DONTNEED ) == 0 )
+    {
+        bRetVal = TRUE;
+    }
+    else
+    {
+        WARN( "madvise failed, errno = %d.\n", errno );
+        SetLastError( ERROR_INTERNAL_ERROR );
+    }
+#else
+    SetLastError( ERROR_NOT_SUPPORTED );
+#endif
+
+ExitVirtualZeroMemory:
+    LOGEXIT( "PAL_VirtualZeroMemory returning %d.\n", bRetVal );
+    return bRetVal;
 }
 
 /*++
@@ -2786,6 +2786,38 @@ int CorUnix::CThreadMachExceptionHandlers::GetIndexOfHandler(exception_mask_t bm
 
 #endif // HAVE_MACH_EXCEPTIONS
 
+/*++
+Function:
+  _beginthreadex
+
+  CRT thread creation used by the recycler and job processor background
+  threads. Threads are created through CreateThread so that they are known
+  to the PAL.
+
+See MSDN doc.
+--*/
+UINT_PTR _beginthreadex(
+   void *security,
+   unsigned stack_size,
+   unsigned ( __stdcall *start_address )( void * ),
+   void *arglist,
+   unsigned initflag,
+   unsigned *thrdaddr)
+{
+    DWORD threadId;
+    HANDLE hThread = CreateThread((LPSECURITY_ATTRIBUTES)security,
+                                  stack_size,
+                                  (LPTHREAD_START_ROUTINE)start_address,
+                                  arglist,
+                                  initflag,
+                                  &threadId);
+    if (hThread != NULL && thrdaddr != NULL)
+    {
+        *thrdaddr = threadId;
+    }
+    return (UINT_PTR)hThread;
+}
+
 void GetCurrentThreadStackLimits(ULONG_PTR* lowLimit, ULONG_PTR* highLimit)
 {
 #ifdef __APPLE__
@@ -0,0 +1,104 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Array.prototype.sort is stable, with and without a comparer, and sorts native int arrays in place.
+
+function write(args)
+{
+    WScript.Echo(args);
+}
+
+function checkStable(name, arr, key)
+{
+    for (var i = 1; i < arr.length; i++)
+    {
+        if (key(arr[i - 1]) === key(arr[i]) && arr[i - 1].index > arr[i].index)
+        {
+            write("FAIL: " + name + " is not stable at " + i);
+            return;
+        }
+    }
+    write(name + " stable");
+}
+
+// Comparer, both below and above the insertion sort run length
+[10, 100, 2000].forEach(function (length)
+{
+    var a = [];
+    for (var i = 0; i < length; i++)
+    {
+        a.push({ key: (i * 7919) % 13, index: i });
+    }
+    a.sort(function (x, y) { return x.key - y.key; });
+    checkStable("comparer " + length, a, function (x) { return x.key; });
+});
+
+// Default comparer, with values that have the same string value
+var b = [];
+for (var i = 0; i < 1000; i++)
+{
+    var value = (i * 31) % 17;
+    b.push({ index: i, value: value, toString: function () { return String(this.value); } });
+}
+b.sort();
+checkStable("default comparer", b, function (x) { return x.value; });
+
+var mixed = [1, "1", 1.0, "01", "1", 1];
+write(mixed.sort().map(function (x) { return typeof x; }).join(","));
+
+// Strings only
+var strings = [];
+for (var i = 0; i < 200; i++)
+{
+    strings.push("s" + ((i * 37) % 101));
+}
+strings.sort();
+var sorted = true;
+for (var i = 1; i < strings.length; i++)
+{
+    sorted = sorted && strings[i - 1] <= strings[i];
+}
+write("strings sorted: " + sorted);
+
+// Native int arrays sort by the string values of their elements
+write([10, 9, 1, -1, -10, 0, 100, -2147483648, 2147483647, 2, -2, 21, -21, 3].sort().join(","));
+write([3, , 1, , 2].sort().join(",") + " length " + [3, , 1, , 2].sort().length);
+
+var ints = [];
+for (var i = 0; i < 5000; i++)
+{
+    ints.push(((i * 2654435761) % 4294967296 | 0) >> (i % 30));
+}
+var expected = ints.map(String).sort().map(Number);
+ints.sort();
+write("native ints: " + (ints.join(",") === expected.join(",")));
+
+// undefined and holes go last
+var c = [5, undefined, , 3, undefined, 1];
+c.sort(function (x, y) { return x - y; });
+write(c.join(",") + " length " + c.length + " has 5: " + (5 in c));
+
+// A comparer that throws leaves every element in the array
+var d = [];
+for (var i = 0; i < 300; i++)
+{
+    d.push((i * 7) % 300);
+}
+var calls = 0;
+try
+{
+    d.sort(function (x, y) { if (++calls === 500) { throw new Error("stop"); } return x - y; });
+}
+catch (e)
+{
+    write("caught " + e.message);
+}
+d.sort(function (x, y) { return x - y; });
+var permutation = d.length === 300;
+for (var i = 0; i < d.length; i++)
+{
+    permutation = permutation && d[i] === i;
+}
+write("permutation kept: " + permutation);
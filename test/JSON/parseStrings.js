@@ -0,0 +1,61 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// String scanning in JSON.parse: escapes, quotes and control characters at every offset within
+// and across runs of plain characters.
+
+var failed = 0;
+function check(json, expected) {
+    var actual = JSON.parse(json);
+    if (actual !== expected) {
+        failed++;
+        WScript.Echo("FAIL: " + JSON.stringify(json) + " => " + JSON.stringify(actual) + ", expected " + JSON.stringify(expected));
+    }
+}
+
+var plain = "abcdefghijklmnopqrstuvwxyz \u00e9\u2028\u2029\uffff ~0123456789ABCDEF";
+var escapes = [["\\n", "\n"], ["\\\"", "\""], ["\\\\", "\\"], ["\\/", "/"], ["\\u001f", "\u001f"], ["\\u00e9", "\u00e9"]];
+
+for (var len = 0; len < 40; len++) {
+    var text = plain.substring(0, len);
+    check('"' + text + '"', text);
+
+    for (var pos = 0; pos <= len; pos++) {
+        for (var e = 0; e < escapes.length; e++) {
+            check('"' + text.substring(0, pos) + escapes[e][0] + text.substring(pos) + '"',
+                text.substring(0, pos) + escapes[e][1] + text.substring(pos));
+        }
+    }
+}
+
+// Property names go through the same scanner
+var keys = Object.keys(JSON.parse('{"' + plain + '":1,"a\\tb":2}'));
+if (keys.length !== 2 || keys[0] !== plain || keys[1] !== "a\tb") {
+    failed++;
+    WScript.Echo("FAIL: property names " + JSON.stringify(keys));
+}
+
+var rejected = 0;
+for (var pos = 0; pos < 20; pos++) {
+    for (var ch = 0; ch < 0x20; ch++) {
+        try {
+            JSON.parse('"' + plain.substring(0, pos) + String.fromCharCode(ch) + plain.substring(pos, 20) + '"');
+        } catch (e) {
+            if (e instanceof SyntaxError) {
+                rejected++;
+            }
+        }
+    }
+}
+if (rejected !== 20 * 0x20) {
+    failed++;
+    WScript.Echo("FAIL: only " + rejected + " strings with control characters were rejected");
+}
+
+try { JSON.parse('"abcdefghij\u0001"'); } catch (e) { WScript.Echo(e); }
+try { JSON.parse('"abcdefghijklmnopqrstuvwxyz'); } catch (e) { WScript.Echo(e); }
+try { JSON.parse('"abcdefghijklmnop\\x"'); } catch (e) { WScript.Echo(e); }
+
+WScript.Echo(failed === 0 ? "PASS" : "FAILED");
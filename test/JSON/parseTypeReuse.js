@@ -0,0 +1,52 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// JSON.parse of arrays of records, where records share some or all of their keys with the records
+// parsed before them, so that cached property layouts are reused, outgrown and abandoned.
+
+function makeRecord(keyCount, prefix, i) {
+    var o = {};
+    for (var k = 0; k < keyCount; k++) {
+        o[prefix + k] = k % 3 === 0 ? i : k % 3 === 1 ? "v" + i : { inner: [i, k] };
+    }
+    return o;
+}
+
+var records = [];
+var sizes = [20, 20, 3, 20, 40, 1, 40, 20, 0, 20, 7];
+for (var i = 0; i < sizes.length; i++) {
+    records.push(makeRecord(sizes[i], "key", i));
+}
+// Same first key, diverging afterwards
+records.push({ key0: 1, other: 2, key2: 3 });
+records.push({ key0: 1, key1: 2, "10": "indexed", key2: 3 });
+records.push(makeRecord(20, "key", 99));
+
+var text = JSON.stringify(records);
+var failed = 0;
+for (var round = 0; round < 3; round++) {
+    var parsed = JSON.parse(text);
+    if (JSON.stringify(parsed) !== text) {
+        failed++;
+        WScript.Echo("FAIL: round " + round);
+    }
+
+    // Objects must stay fully usable after being built from cached types
+    for (var i = 0; i < parsed.length; i++) {
+        var o = parsed[i];
+        var keys = Object.keys(o);
+        if (keys.length === 0) {
+            continue;
+        }
+        o.added = i;
+        delete o[keys[0]];
+        if (o.added !== i || keys[0] in o || Object.keys(o).length !== keys.length) {
+            failed++;
+            WScript.Echo("FAIL: record " + i + " in round " + round);
+        }
+    }
+}
+
+WScript.Echo(failed === 0 ? "PASS" : "FAILED");
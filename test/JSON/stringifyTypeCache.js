@@ -0,0 +1,66 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// JSON.stringify of many objects sharing a type, including cases where the shape changes while
+// the objects are being serialized.
+
+function record(i) {
+    return { id: i, "na\"me": "item" + i, nested: { x: i, y: [i, i + 1] }, missing: undefined, fn: function () {} };
+}
+
+var records = [];
+for (var i = 0; i < 4; i++) {
+    records.push(record(i));
+}
+WScript.Echo(JSON.stringify(records));
+WScript.Echo(JSON.stringify(records, null, 2));
+WScript.Echo(JSON.stringify(records, ["id", "nested", "x"]));
+WScript.Echo(JSON.stringify(records, function (k, v) { return k === "id" ? v * 10 : v; }));
+
+// Symbol-keyed properties are not serialized
+var sym = Symbol("s");
+var withSymbols = [];
+for (var i = 0; i < 3; i++) {
+    var o = { a: i };
+    o[sym] = i;
+    o.b = -i;
+    withSymbols.push(o);
+}
+WScript.Echo(JSON.stringify(withSymbols));
+
+// toJSON on a member deletes a later property of its holder
+var deleting = [];
+for (var i = 0; i < 3; i++) {
+    deleting.push({ first: { toJSON: function (key) { delete this.holder.last; return key; }, holder: null }, middle: i, last: "kept" });
+    deleting[i].first.holder = deleting[i];
+}
+WScript.Echo(JSON.stringify(deleting));
+
+// toJSON on a member adds a property and changes a later value of its holder
+var adding = [];
+for (var i = 0; i < 3; i++) {
+    adding.push({ first: { toJSON: function () { this.holder.added = 1; this.holder.last = "changed"; return 0; }, holder: null }, last: "original" });
+    adding[i].first.holder = adding[i];
+}
+WScript.Echo(JSON.stringify(adding));
+
+// Objects of the cached type that later gain an accessor, a toJSON or indexed properties
+var changing = [{ p: 1, q: 2 }, { p: 3, q: 4 }, { p: 5, q: 6 }, { p: 7, q: 8 }, { p: 9, q: 10 }];
+Object.defineProperty(changing[2], "q", { get: function () { return "getter"; }, enumerable: true });
+changing[3].toJSON = function () { return "toJSON"; };
+changing[4][0] = "indexed";
+WScript.Echo(JSON.stringify(changing));
+
+// Values that themselves have toJSON
+var dated = [];
+for (var i = 0; i < 3; i++) {
+    dated.push({ when: { toJSON: function (key) { return "at:" + key; } }, n: i });
+}
+WScript.Echo(JSON.stringify(dated));
+
+// Cycle through a cached type is still detected
+var cyclic = [{ self: null }, { self: null }];
+cyclic[1].self = cyclic;
+try { JSON.stringify(cyclic); } catch (e) { WScript.Echo(e.name); }
@@ -0,0 +1,87 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Leave holes of freed int array segments (leaf allocations) between live ones in medium and large heap
+// blocks, then allocate into the holes again. Arrays that reuse a hole, and the ones around it, must read
+// back intact. With -RecyclerDiscardFreeObjectPages the sweeps hand the pages inside the holes back to
+// the OS, which JsGetRuntimeGCStats reports as discarded bytes.
+
+var live = [];
+
+function makeArray(length, seed)
+{
+    var a = new Array(length);
+    for (var i = 0; i < length; i++)
+    {
+        a[i] = seed + i;
+    }
+    return a;
+}
+
+function checkArray(a, length, seed)
+{
+    if (a.length !== length)
+    {
+        return false;
+    }
+    for (var i = 0; i < length; i += 509)
+    {
+        if (a[i] !== seed + i)
+        {
+            return false;
+        }
+    }
+    return a[length - 1] === seed + length - 1;
+}
+
+function allocate(round)
+{
+    for (var i = 0; i < 600; i++)
+    {
+        // Medium sized segments, and large ones of a few pages
+        var length = (i % 3 == 0) ? 1500 + (i * 37) % 3000 : 6000 + (i * 131) % 40000;
+        var seed = round * 100000 + i;
+        var a = makeArray(length, seed);
+        if (i % 4 == 0)
+        {
+            live.push({ a: a, length: length, seed: seed });
+        }
+    }
+}
+
+function verify()
+{
+    for (var k = 0; k < live.length; k++)
+    {
+        var entry = live[k];
+        if (!checkArray(entry.a, entry.length, entry.seed))
+        {
+            return "FAIL: array " + entry.seed;
+        }
+    }
+    return null;
+}
+
+var discardedBytes = WScript.GetGCStats().discardedBytes;
+
+var result = null;
+for (var round = 0; round < 5 && !result; round++)
+{
+    allocate(round);
+    CollectGarbage();
+    result = verify();
+
+    // Free some of the survivors too, so later rounds allocate into holes between live arrays
+    live = live.filter(function (entry, index) { return index % 3 != 1; });
+}
+
+if (!result)
+{
+    CollectGarbage();
+    result = verify();
+}
+
+WScript.Echo(result || "PASS");
+WScript.Echo("pages of freed objects returned to the OS: " + (WScript.GetGCStats().discardedBytes > discardedBytes));
@@ -0,0 +1,30 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// JsSetRuntimeGCHeuristics checks its arguments, and refuses to change the policy of a runtime that is running script.
+// Without a policy set, the runtime collects every 1MB allocated.
+
+function trySet()
+{
+    try
+    {
+        WScript.SetGCHeuristics.apply(WScript, arguments);
+        return "JsNoError";
+    }
+    catch (e)
+    {
+        return e.message;
+    }
+}
+
+WScript.Echo("next collection bytes: " + WScript.GetGCStats().nextCollectionBytes);
+
+WScript.Echo("unknown mode: " + trySet("sometimes"));
+WScript.Echo("pause time over 100%: " + trySet("adaptive", 100, 101));
+WScript.Echo("min trigger over max: " + trySet("adaptive", 100, 5, 2 * 1024 * 1024, 1024 * 1024));
+WScript.Echo("adaptive while running: " + trySet("adaptive"));
+WScript.Echo("default while running: " + trySet("default"));
+
+WScript.Echo("next collection bytes: " + WScript.GetGCStats().nextCollectionBytes);
@@ -0,0 +1,27 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Run with -GCHeuristic:adaptive -GCHeapGrowthPercent:200, which ch sets through JsSetRuntimeGCHeuristics
+// before running script: after a collection the runtime lets the heap grow by at least twice what was live.
+
+var live = [];
+for (var i = 0; i < 200000; i++)
+{
+    live.push({ index: i, name: "item" + i, next: null });
+}
+
+CollectGarbage();
+
+var stats = WScript.GetGCStats();
+var liveBytes = 0;
+for (var i = 0; i < stats.liveBytes.length; i++)
+{
+    liveBytes += stats.liveBytes[i];
+}
+
+WScript.Echo("live heap over 4MB: " + (liveBytes > 4 * 1024 * 1024));
+WScript.Echo("next collection after twice the live heap: " + (stats.nextCollectionBytes >= Math.floor(liveBytes / 100) * 200));
+WScript.Echo("next collection later than with the default policy: " + (stats.nextCollectionBytes > 1024 * 1024));
+WScript.Echo(live.length);
@@ -0,0 +1,125 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Fill small and medium heap buckets of every kind, drop most of it and collect, so the sweep
+// frees whole blocks as well as single objects. The survivors must come through intact, and each
+// collection must have shared its sweep with the parallel threads (unless -off:ParallelSweep).
+
+var survivors = [];
+
+function makeObject(i, propertyCount)
+{
+    var o = { id: i };
+    for (var p = 0; p < propertyCount; p++)
+    {
+        o["p" + p] = i + p;
+    }
+    return o;
+}
+
+function checkObject(o, i, propertyCount)
+{
+    if (o.id !== i)
+    {
+        return false;
+    }
+    for (var p = 0; p < propertyCount; p++)
+    {
+        if (o["p" + p] !== i + p)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+function allocate(round)
+{
+    var garbage = [];
+    for (var i = 0; i < 20000; i++)
+    {
+        var propertyCount = i % 24;
+        var small = makeObject(i, propertyCount);                // normal buckets
+        var leaf = "s" + i + "-" + round;                        // leaf buckets
+        var medium = (i % 50 == 0) ? new Array(600 + i % 700) : null;   // medium buckets
+        if (medium)
+        {
+            for (var j = 0; j < medium.length; j++)
+            {
+                medium[j] = j;
+            }
+        }
+
+        if (i % 97 == 0)
+        {
+            survivors.push({ round: round, i: i, propertyCount: propertyCount, small: small, leaf: leaf, medium: medium });
+        }
+        else
+        {
+            garbage.push(small, leaf, medium);
+        }
+    }
+    return garbage.length;
+}
+
+function verify()
+{
+    for (var k = 0; k < survivors.length; k++)
+    {
+        var s = survivors[k];
+        if (!checkObject(s.small, s.i, s.propertyCount))
+        {
+            return "FAIL: object " + s.i + " in round " + s.round;
+        }
+        if (s.leaf !== "s" + s.i + "-" + s.round)
+        {
+            return "FAIL: string " + s.i + " in round " + s.round;
+        }
+        if (s.medium)
+        {
+            for (var j = 0; j < s.medium.length; j++)
+            {
+                if (s.medium[j] !== j)
+                {
+                    return "FAIL: array " + s.i + " in round " + s.round;
+                }
+            }
+        }
+    }
+    return null;
+}
+
+var parallelSweepCount = WScript.GetGCStats().parallelSweepCount;
+var collectionCount = 0;
+
+for (var round = 0; round < 6; round++)
+{
+    allocate(round);
+    CollectGarbage();
+    collectionCount++;
+
+    // Drop half of the survivors so later sweeps empty blocks that were live before
+    if (round % 2 == 1)
+    {
+        survivors = survivors.filter(function (s, index) { return index % 2 == 0; });
+        CollectGarbage();
+        collectionCount++;
+    }
+
+    var result = verify();
+    if (result)
+    {
+        WScript.Echo(result);
+        break;
+    }
+}
+
+if (!result)
+{
+    WScript.Echo("PASS");
+}
+
+parallelSweepCount = WScript.GetGCStats().parallelSweepCount - parallelSweepCount;
+WScript.Echo("every collection swept on the parallel threads: " + (parallelSweepCount >= collectionCount));
@@ -0,0 +1,31 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Collect from under 20 interpreter frames. The in-thread stack scan scans those frames precisely
+// (unless -off:PreciseStackFrames), which JsGetRuntimeGCStats reports.
+
+function recurse(depth, garbage)
+{
+    var local = { depth: depth, garbage: garbage };
+    if (depth === 0)
+    {
+        CollectGarbage();
+        return local.depth;
+    }
+    return recurse(depth - 1, [depth]) + local.depth;
+}
+
+var before = WScript.GetGCStats();
+var sum = recurse(20, null);
+var after = WScript.GetGCStats();
+
+var frameCount = after.preciseStackFrameCount - before.preciseStackFrameCount;
+var frameBytes = after.preciseStackFrameBytes - before.preciseStackFrameBytes;
+var skippedBytes = after.preciseStackSkippedBytes - before.preciseStackSkippedBytes;
+
+WScript.Echo("sum: " + sum);
+WScript.Echo("all recursive frames scanned precisely: " + (frameCount >= 21));
+WScript.Echo("frames have bytes: " + (frameBytes > 0));
+WScript.Echo("skipped bytes within frame bytes: " + (skippedBytes <= frameBytes));
@@ -0,0 +1,43 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// External objects and ArrayBuffers created with thread agnostic finalizers. After a collection
+// their finalizers must run on the recycler's finalizer thread, not the script thread (unless
+// -RecyclerBackgroundFinalize-). The last batch is still queued when the script ends; ch reports
+// after JsDisposeRuntime that every finalizer has run by then.
+
+var live = [];
+
+function allocate(count, keepEvery)
+{
+    for (var i = 0; i < count; i++)
+    {
+        var object = WScript.CreateThreadAgnosticObject();
+        var arrayBuffer = WScript.CreateThreadAgnosticArrayBuffer(64 + i % 64);
+        new Uint8Array(arrayBuffer)[0] = i & 0xFF;
+        if (keepEvery && i % keepEvery == 0)
+        {
+            live.push(object, arrayBuffer);
+        }
+    }
+}
+
+allocate(1000, 0);
+CollectGarbage();
+
+// The callbacks run asynchronously; give the finalizer thread some time to get to them. This polls a
+// bounded number of times rather than for a fixed time, since Date.now isn't implemented on Linux yet.
+var stats = WScript.GetThreadAgnosticFinalizeStats();
+for (var polls = 0; stats.finalizedCount == 0 && polls < 1000000; polls++)
+{
+    stats = WScript.GetThreadAgnosticFinalizeStats();
+}
+
+WScript.Echo("created: " + stats.createdCount);
+WScript.Echo("finalizers ran off the script thread: " + (stats.finalizedCount > 0 && stats.finalizedInThreadCount == 0));
+
+// Queue another batch and end the script without waiting for it; some objects stay live until shutdown
+allocate(1000, 10);
+CollectGarbage();
@@ -0,0 +1,68 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Each WeakMap and WeakSet key takes a recycler weak reference, so a round of keys puts enough
+// entries in the weak reference map for its cleanup to be split into partitions for the parallel
+// threads. Most keys die between collections; the live ones must still find their values, and each
+// collection right after a round must have cleaned up the map on the parallel threads (unless
+// -off:ParallelSweep).
+
+var weakMap = new WeakMap();
+var weakSet = new WeakSet();
+var live = [];
+
+function addKeys(round, keyCount)
+{
+    for (var i = 0; i < keyCount; i++)
+    {
+        var key = { round: round, i: i };
+        weakMap.set(key, round * keyCount + i);
+        weakSet.add(key);
+        if (i % 7 == 0)
+        {
+            live.push(key);
+        }
+    }
+}
+
+function verify(keyCount)
+{
+    for (var k = 0; k < live.length; k++)
+    {
+        var key = live[k];
+        if (weakMap.get(key) !== key.round * keyCount + key.i || !weakSet.has(key))
+        {
+            return "FAIL: key " + key.i + " in round " + key.round;
+        }
+    }
+    return null;
+}
+
+var parallelWeakReferenceSweepCount = WScript.GetGCStats().parallelWeakReferenceSweepCount;
+var collectionCount = 0;
+
+var keyCount = 40000;
+var result = null;
+for (var round = 0; round < 5 && !result; round++)
+{
+    addKeys(round, keyCount);
+    CollectGarbage();
+    collectionCount++;
+
+    // Let some of the live keys die so entries keep coming and going. Too few weak references are
+    // left by now for this collection to go parallel, so it isn't counted.
+    if (round % 2 == 1)
+    {
+        live = live.filter(function (key, index) { return index % 3 != 0; });
+        CollectGarbage();
+    }
+
+    result = verify(keyCount);
+}
+
+WScript.Echo(result || "PASS");
+
+parallelWeakReferenceSweepCount = WScript.GetGCStats().parallelWeakReferenceSweepCount - parallelWeakReferenceSweepCount;
+WScript.Echo("weak reference map cleaned up on the parallel threads: " + (parallelWeakReferenceSweepCount >= collectionCount));
@@ -0,0 +1,55 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Strings over host buffers, through JsCreateExternalString (UTF-16) and JsCreateExternalStringUtf8.
+// ch copies the argument into a buffer followed by '#' instead of a null terminator, so any operation
+// that read the buffer as null terminated would show it. The finalize callbacks must run once the
+// strings are collected, and all of them by the time the runtime is disposed.
+
+// Non-ASCII characters are echoed as \u escapes
+function echo(label, value)
+{
+    WScript.Echo(label + ": " + String(value).replace(/[^\x20-\x7e]/g, function (c) {
+        return "\\u" + ("000" + c.charCodeAt(0).toString(16)).slice(-4);
+    }));
+}
+
+function check(label, create, text)
+{
+    var s = create(text);
+    var object = {};
+    object[s] = 1;
+
+    echo(label, s);
+    echo(label + " length", s.length + " " + (s.length === text.length));
+    echo(label + " equals", (s === text) + " " + (text === s) + " " + new Map([[text, "found"]]).get(s));
+    echo(label + " chars", s.charAt(0) + " " + s.charCodeAt(s.length - 1) + " " + s[1] + " " + s.indexOf(text.slice(2)));
+    echo(label + " copies", s + "|" + s.slice(1) + "|" + s.repeat(2) + "|" + [s, s].join(","));
+    echo(label + " needs a terminated buffer", Object.keys(object)[0] + " " + JSON.stringify(s) + " " + /.$/.exec(s)[0] + " " + parseInt(s + "1", 36));
+}
+
+check("utf16 ascii", WScript.CreateExternalString, "content-type");
+check("utf16 non-ascii", WScript.CreateExternalString, "caf\u00e9 \u4e2d\ud83d\ude00");
+check("utf8 ascii", WScript.CreateExternalStringUtf8, "content-type");
+check("utf8 non-ascii", WScript.CreateExternalStringUtf8, "na\u00efve \u4e2d \ud83d\ude00");
+check("utf8 latin1", WScript.CreateExternalStringUtf8, "\u00ff\u00e9");
+
+function createGarbage(count)
+{
+    for (var i = 0; i < count; i++)
+    {
+        WScript.CreateExternalString("garbage " + i).length;
+        WScript.CreateExternalStringUtf8("garbage " + i).length;
+    }
+}
+
+createGarbage(100);
+var finalizedCount = WScript.GetExternalStringStats().finalizedCount;
+CollectGarbage();
+echo("finalizers ran on collection", WScript.GetExternalStringStats().finalizedCount > finalizedCount);
+
+// Some strings are still live at shutdown
+var live = [WScript.CreateExternalString("live"), WScript.CreateExternalStringUtf8("live \u00e9")];
+echo("created", WScript.GetExternalStringStats().createdCount);
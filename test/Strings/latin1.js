@@ -0,0 +1,65 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Strings from the host (WScript.Arguments goes through JsPointerToString) are kept one byte per
+// character when they fit in Latin-1. JSON.parse still creates ordinary char16 strings; those supply
+// the non-ASCII text the one-byte strings are compared with. Everything below must behave the same
+// as with -Latin1Strings-.
+
+// Non-ASCII characters are echoed as \u escapes
+function echo(label, value)
+{
+    WScript.Echo(label + ": " + String(value).replace(/[^\x20-\x7e]/g, function (c) {
+        return "\\u" + ("000" + c.charCodeAt(0).toString(16)).slice(-4);
+    }));
+}
+
+var ascii = WScript.Arguments[0];
+var repeat = WScript.Arguments[1];
+var parsed = JSON.parse('{ "latin1": "caf\\u00e9 na\\u00efve \\u00ff", "wide": "\\u0100 and \\u4e2d", "empty": "", "single": "x" }');
+var latin1 = parsed.latin1;
+var wide = parsed.wide;
+
+// Characters read in place
+echo("charAt", ascii.charAt(0) + ascii.charAt(12) + latin1.charAt(3));
+echo("charCodeAt", [ascii.charCodeAt(0), latin1.charCodeAt(3), latin1.charCodeAt(latin1.length - 1), wide.charCodeAt(0)].join());
+echo("index", ascii[8] + latin1[3] + (ascii[ascii.length] === undefined));
+echo("out of range", ascii.charAt(100) === "" && isNaN(latin1.charCodeAt(-1)));
+
+// indexOf on a one-byte string, with one-byte and char16 search strings
+echo("indexOf", [
+    ascii.indexOf("json"), ascii.indexOf("c"), ascii.indexOf(":"), ascii.indexOf("application/json"),
+    ascii.indexOf("content-type:application/json"), ascii.indexOf("content-type:application/jsonx"),
+    ascii.indexOf("JSON"), ascii.indexOf("n", 3), ascii.indexOf("n", 100), ascii.indexOf("", 5)].join());
+echo("indexOf latin1", [latin1.indexOf("\u00e9"), latin1.indexOf("na\u00efve"), latin1.indexOf("\u00ff"),
+    latin1.indexOf("\u0100"), latin1.indexOf("\u00e9\u0100")].join());
+echo("indexOf partial matches", [repeat.indexOf("abd"), repeat.indexOf("abc", 1), repeat.indexOf("bd"), repeat.indexOf("abcabd")].join());
+echo("indexOf wide", [wide.indexOf("\u4e2d"), wide.indexOf("and")].join());
+echo("includes", ascii.includes("type") + " " + latin1.includes("\u00ef") + " " + ascii.includes("\u0163"));
+
+// Comparison and hashing against the char16 forms of the same text
+echo("equals", (ascii === "content-type:application/json") + " " + (latin1 == "caf\u00e9 na\u00efve \u00ff") + " " + (ascii === latin1));
+echo("compare", (ascii < latin1) + " " + (latin1 > "caf") + " " + ["b", latin1, ascii, "a"].sort().join("|"));
+
+var map = new Map();
+map.set("content-type:application/json", 1);
+map.set(latin1, 2);
+echo("map", map.get(ascii) + " " + map.get("caf\u00e9 na\u00efve \u00ff") + " " + map.has(wide));
+var set = new Set([ascii, "content-type:application/json", latin1]);
+echo("set", set.size);
+
+var object = {};
+object[ascii] = "by key";
+echo("property", object["content-type:application/json"] + " " + Object.keys(object)[0]);
+
+// Operations that copy or widen
+echo("concat", ascii + " | " + latin1);
+echo("slice", ascii.slice(13) + " " + latin1.substring(0, 4) + " " + ascii.toUpperCase());
+echo("split", ascii.split(":").join(","));
+echo("regex", /app\w+/.exec(ascii)[0] + " " + ascii.replace(/-/g, "_") + " " + /\u00efve/.test(latin1));
+echo("stringify", JSON.stringify(parsed));
+echo("empty and single", parsed.empty.length + " " + parsed.single + " " + parsed.single.charCodeAt(0));
+
+echo("arguments", WScript.Arguments.length + " " + ascii.length + " " + repeat.length);
@@ -0,0 +1,73 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// The UTF-8 codex converts ASCII 16 code units at a time and leaves the rest of the text to the scalar
+// code. WScript.CreateExternalStringUtf8 encodes its argument to UTF-8 in ch and the engine decodes it
+// back, counting the characters first, so a round trip goes through the encode, count and decode paths.
+// The texts are one short of, exactly, one past and almost two blocks long, with a non-ASCII character
+// in the first and last lane of a block and at the end of the text.
+
+var filler = "abcdefghijklmnopqrstuvwxyz0123456789";
+
+function makeText(length, position, c)
+{
+    var text = filler.slice(0, length);
+    return position < 0 ? text : text.slice(0, position) + c + text.slice(position + 1);
+}
+
+function check(length, position, c)
+{
+    var text = makeText(length, position, c);
+    var failures = [];
+
+    // Each check takes a fresh string, since the first read decodes the buffer and keeps the result
+    var s = WScript.CreateExternalStringUtf8(text);
+    if (s.length !== text.length)
+    {
+        failures.push("length " + s.length);
+    }
+
+    s = WScript.CreateExternalStringUtf8(text);
+    if (s + "|" !== text + "|")
+    {
+        failures.push("copy");
+    }
+
+    s = WScript.CreateExternalStringUtf8(text);
+    var object = {};
+    object[s] = 1;
+    if (Object.keys(object)[0] !== text)
+    {
+        failures.push("terminated copy");
+    }
+
+    s = WScript.CreateExternalStringUtf8(text);
+    for (var i = 0; i < text.length; i++)
+    {
+        if (s.charCodeAt(i) !== text.charCodeAt(i))
+        {
+            failures.push("char " + i + " " + s.charCodeAt(i));
+            break;
+        }
+    }
+
+    var label = "length " + length + (position < 0 ? ", ascii" : ", \\u" + ("000" + c.charCodeAt(0).toString(16)).slice(-4) + " at " + position);
+    WScript.Echo(label + ": " + (failures.length === 0 ? "ok" : failures.join(", ")));
+}
+
+[15, 16, 17, 31].forEach(function (length)
+{
+    check(length, -1);
+    ["\u00e9", "\u4e2d"].forEach(function (c)
+    {
+        [0, 15, 16, length - 1].forEach(function (position, index, positions)
+        {
+            if (position < length && positions.indexOf(position) === index)
+            {
+                check(length, position, c);
+            }
+        });
+    });
+});
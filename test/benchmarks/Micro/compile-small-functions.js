@@ -0,0 +1,16 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Many small, distinct compiles, so the time is dominated by parser and byte code generator setup
+// rather than by the code itself. Run it once as is and once with -CompileArenaRetainedBytes:0 to
+// compare with and without the pooled compile arenas.
+
+var sum = 0;
+
+MicroBenchmark.run(20000, function (i) {
+    var f = new Function("a", "b", "var x = a * " + i + " + b; return x > " + (i >> 1) + " ? x - a : x + b;");
+    sum += f(i, 1);
+    sum += eval("(" + i + " & 0xff) + " + (i % 7));
+});
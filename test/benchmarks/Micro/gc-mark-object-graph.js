@@ -0,0 +1,44 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Full collections over a large live object graph (~200MB of recycler pages), so the time is
+// dominated by marking. Run it once as is and once with -RecyclerHugePageSegments to compare mark
+// throughput with and without huge page backing.
+
+function Node(id, left, right) {
+    this.id = id;
+    this.left = left;
+    this.right = right;
+    this.payload = [id, id + 1, id + 2, id + 3];
+}
+
+function tree(depth, id) {
+    if (depth === 0) {
+        return new Node(id, null, null);
+    }
+    return new Node(id, tree(depth - 1, id * 2), tree(depth - 1, id * 2 + 1));
+}
+
+var roots = [];
+for (var i = 0; i < 16; i++) {
+    roots.push(tree(16, i));
+}
+
+// Cross links so the graph isn't just a set of independent trees
+var seed = 1;
+for (var i = 0; i < 200000; i++) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    var from = roots[seed % roots.length];
+    var to = roots[(seed >> 8) % roots.length];
+    for (var d = 0; d < 12 && from.left; d++) {
+        from = (seed >> d) & 1 ? from.left : from.right;
+        to = (seed >> (d + 4)) & 1 ? to.left : to.right;
+    }
+    from.payload.push(to);
+}
+
+MicroBenchmark.run(20, function () {
+    CollectGarbage();
+});
@@ -0,0 +1,27 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Full collections with ~400K entries in the recycler's weak reference map (each WeakMap key takes
+// one), of which a quarter die before every collection. Run it once as is and once with
+// -off:ParallelSweep to compare cleaning up the map's partitions on the parallel threads with
+// cleaning them up on the main thread.
+
+var weakMap = new WeakMap();
+var keys = [];
+for (var i = 0; i < 400000; i++) {
+    var key = { i: i };
+    weakMap.set(key, i);
+    keys.push(key);
+}
+
+MicroBenchmark.run(20, function (iteration) {
+    // Replace every fourth key, starting at a different offset each time
+    for (var i = iteration % 4; i < keys.length; i += 4) {
+        var key = { i: i };
+        weakMap.set(key, i);
+        keys[i] = key;
+    }
+    CollectGarbage();
+});
@@ -0,0 +1,29 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Shared driver for the micro benchmarks in this directory, each of which isolates one engine
+// path rather than modelling an application. Run one with
+//     ch harness.js -args <benchmark>.js
+// (paths relative to the current directory), or all of them with perftest.pl -micro.
+// A benchmark builds its input first and then calls MicroBenchmark.run; only the calls to
+// body are timed, and the total is reported in the "### TIME:" form perftest.pl parses.
+
+var MicroBenchmark = {
+    run: function (iterations, body) {
+        var start = new Date();
+        for (var i = 0; i < iterations; i++) {
+            body(i);
+        }
+        var interval = new Date() - start;
+
+        WScript.Echo("### TIME:", interval, "ms");
+    }
+};
+
+if (WScript.Arguments.length !== 1) {
+    WScript.Echo("Usage: ch harness.js -args <benchmark>.js");
+} else {
+    WScript.LoadScriptFile(WScript.Arguments[0]);
+}
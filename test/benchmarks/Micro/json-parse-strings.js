@@ -0,0 +1,34 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// JSON.parse of a string-heavy API payload (~2MB), so the time is dominated by JSON string scanning.
+
+var words = ["account", "balance", "transfer", "pending", "settled", "description", "merchant",
+             "category", "reference", "currency", "approved", "statement", "recurring", "invoice"];
+
+function sentence(seed, length) {
+    var s = "";
+    while (s.length < length) {
+        s += words[(seed = (seed * 1103515245 + 12345) & 0x7fffffff) % words.length] + " ";
+    }
+    return s;
+}
+
+var records = [];
+for (var i = 0; i < 4000; i++) {
+    records.push({
+        id: i,
+        name: sentence(i, 24),
+        memo: sentence(i + 1, 200),
+        // A few escapes per record so both the direct-mapped and unescaped string paths are exercised
+        note: "line one\nline \"two\"\t" + sentence(i + 2, 120) + "\\ \u00e9t\u00e9 \u2028 end",
+        tags: [sentence(i + 3, 16), sentence(i + 4, 16), sentence(i + 5, 16)]
+    });
+}
+var data = JSON.stringify({ records: records, generated: "2008-10-17 23:56:06.000" });
+
+MicroBenchmark.run(20, function () {
+    JSON.parse(data);
+});
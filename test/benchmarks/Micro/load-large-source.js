@@ -0,0 +1,22 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Loads a few MB of mostly ASCII script through WScript.LoadScript, so the time is dominated by
+// transcoding the source to UTF-8 and scanning it back, with the functions only defined, never run.
+// The last line is not ASCII, so the scalar paths run too.
+
+var parts = [];
+for (var i = 0; i < 40000; i++) {
+    parts.push("function f" + i + "(a, b) { var s = \"the quick brown fox jumps over the lazy dog " + i +
+        "\"; return a + b + s.length; }\n");
+}
+parts.push("var caf\u00e9 = '\u00fcber \u4e2d\u6587';\n");
+var source = parts.join("");
+
+WScript.Echo("### SOURCE:", source.length, "chars");
+
+MicroBenchmark.run(10, function () {
+    WScript.LoadScript(source, "samethread");
+});
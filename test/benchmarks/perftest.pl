@@ -32,6 +32,7 @@ my $is_baseline = 0;
 my $basefile = "perfbase.txt";
 my $binary = "";
 my $dir = "";
+my $harness = "";
 my $highprecisiondate = 1;
 my $args;
 my $parse_scores = 0;
@@ -511,7 +512,15 @@ sub runtest
     else
     {
         my $testpath = File::Spec->catfile($dir, $testcasename);
-        system("$binary $switches{$variant} $other_switches $testpath.js > _time.txt");
+        if(!$harness)
+        {
+            system("$binary $switches{$variant} $other_switches $testpath.js > _time.txt");
+        }
+        else
+        {
+            my $harnesspath = File::Spec->catfile($dir, $harness);
+            system("$binary $switches{$variant} $other_switches $harnesspath -args $testpath.js -endargs > _time.txt");
+        }
     }
 
     open(my $IN, '<', "_time.txt") or die;
@@ -577,6 +586,7 @@ sub usage
     print "  -kraken                Run the kraken benchmark\n";
     print "  -octane                Run the Octane 2.0 benchmark\n";
     print "  -jetstream             Run the JetStream benchmark (only non octane and sunspider tests)\n";
+    print "  -micro                 Run the engine micro benchmarks\n";
     print "  -file:<file>           Run the specified js file\n";
     print "  -args:<other args>     Other arguments to ch.exe\n";
     print "  -score                 Test output scores\n";
@@ -712,6 +722,18 @@ sub parse_args
             $basefile = "perfbase$dir.txt";
             $is_dynamicProfileRun = 1;
         }
+        elsif($ARGV[$i] =~ /[-\/]micro/i)
+        {
+            if($iter == $defaultIter)
+            {
+                $iter = 10;
+            }
+            @testlist = ("compile-small-functions", "gc-mark-object-graph", "json-parse-strings", "load-large-source");
+            $testDescription = "micro benchmarks";
+            $dir = "Micro";
+            $harness = "harness.js";
+            $basefile = "perfbase$dir.txt";
+        }
         elsif($ARGV[$i] =~ /[-\/]file:(.*).js$/i)
         {
             # only supports octane, add additional support here for jetstream
@@ -0,0 +1,92 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// %TypedArray%.prototype.sort without a comparator sorts natively per element type: small arrays
+// with an introsort, large integer arrays with a radix sort. Check both against a plain array sort.
+
+var seed = 1;
+function random()
+{
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    return seed / 2147483648;
+}
+
+function compareNumbers(x, y)
+{
+    if (x !== x) return (y !== y) ? 0 : 1;
+    if (y !== y) return -1;
+    if (x < y) return -1;
+    if (x > y) return 1;
+    if (x === 0 && y === 0) return (1 / x) - (1 / y) < 0 ? -1 : ((1 / x) - (1 / y) > 0 ? 1 : 0);
+    return 0;
+}
+
+function sameValue(x, y)
+{
+    return (x === y && (x !== 0 || 1 / x === 1 / y)) || (x !== x && y !== y);
+}
+
+function check(name, typedArray)
+{
+    var expected = Array.prototype.slice.call(typedArray).sort(compareNumbers);
+    var result = typedArray.sort();
+    if (result !== typedArray)
+    {
+        return "FAIL: " + name + " sort did not return the array";
+    }
+    for (var i = 0; i < expected.length; i++)
+    {
+        if (!sameValue(typedArray[i], expected[i]))
+        {
+            return "FAIL: " + name + " length " + typedArray.length + " index " + i + ": " + typedArray[i] + " != " + expected[i];
+        }
+    }
+    return null;
+}
+
+var integerTypes = [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array, Int32Array, Uint32Array];
+var floatTypes = [Float32Array, Float64Array];
+var lengths = [0, 1, 2, 3, 16, 17, 100, 255, 256, 257, 5000, 20000];
+var result = null;
+
+integerTypes.forEach(function (type)
+{
+    lengths.forEach(function (length)
+    {
+        // Full range values, a few distinct values, and values that only differ in the low byte
+        [4294967296, 5, 256].forEach(function (range)
+        {
+            var a = new type(length);
+            for (var i = 0; i < length; i++)
+            {
+                a[i] = Math.floor(random() * range) - (range > 256 ? 2147483648 : 0);
+            }
+            result = result || check(type.name, a);
+        });
+    });
+});
+
+floatTypes.forEach(function (type)
+{
+    var specials = [NaN, -0, 0, Infinity, -Infinity, 1.5, -1.5];
+    lengths.forEach(function (length)
+    {
+        var a = new type(length);
+        for (var i = 0; i < length; i++)
+        {
+            a[i] = (random() < 0.3) ? specials[Math.floor(random() * specials.length)] : (random() - 0.5) * 1000;
+        }
+        result = result || check(type.name, a);
+    });
+});
+
+// The comparator path is unchanged
+var withComparator = new Int32Array([3, 1, 2]).sort(function (x, y) { return y - x; });
+if (withComparator[0] !== 3 || withComparator[1] !== 2 || withComparator[2] !== 1)
+{
+    result = result || "FAIL: comparator";
+}
+
+WScript.Echo(result || "PASS");